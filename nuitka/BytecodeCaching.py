@@ -10,6 +10,7 @@ such that it allows to restore it directly.
 import os
 import sys
 
+from nuitka.containers.OrderedDicts import OrderedDict
 from nuitka.containers.OrderedSets import OrderedSet
 from nuitka.importing.Importing import locateModule, makeModuleUsageAttempt
 from nuitka.plugins.Plugins import Plugins
@@ -53,7 +54,7 @@ def hasCachedImportedModuleUsageAttempts(module_name, source_code, source_ref):
 _cache_format_version = 6
 
 
-def getCachedImportedModuleUsageAttempts(module_name, source_code, source_ref):
+def _getCacheData(module_name, source_code):
     cache_name = makeCacheName(module_name, source_code)
     cache_filename = _getCacheFilename(cache_name, "json")
 
@@ -71,6 +72,15 @@ def getCachedImportedModuleUsageAttempts(module_name, source_code, source_ref):
     if data["module_name"] != module_name:
         return None
 
+    return data
+
+
+def getCachedImportedModuleUsageAttempts(module_name, source_code, source_ref):
+    data = _getCacheData(module_name, source_code)
+
+    if data is None:
+        return None
+
     result = OrderedSet()
 
     for module_used in data["modules_used"]:
@@ -121,6 +131,17 @@ def getCachedImportedModuleUsageAttempts(module_name, source_code, source_ref):
     return result
 
 
+def getCachedUsedDistributions(module_name, source_code):
+    """Distributions used by the module as cached, None if not in the cache."""
+
+    data = _getCacheData(module_name, source_code)
+
+    if data is None:
+        return None
+
+    return OrderedDict(data["distribution_names"])
+
+
 def writeImportedModulesNamesToCache(
     module_name, source_code, used_modules, distribution_names
 ):
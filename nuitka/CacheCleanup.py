@@ -10,6 +10,7 @@ caches and is supposed to run before or instead of Nuitka compilation.
 import os
 
 from nuitka.BytecodeCaching import getBytecodeCacheDir
+from nuitka.code_generation.ModuleCodeCaching import getModuleCodeCacheDir
 from nuitka.Tracing import cache_logger
 from nuitka.utils.AppDirs import getCacheDir
 from nuitka.utils.FileOperations import removeDirectory
@@ -35,6 +36,7 @@ def cleanCaches():
     _cleanCacheDirectory("ccache", getCacheDir("ccache"))
     _cleanCacheDirectory("clcache", getCacheDir("clcache"))
     _cleanCacheDirectory("bytecode", getBytecodeCacheDir())
+    _cleanCacheDirectory("code", getModuleCodeCacheDir())
     _cleanCacheDirectory("dll-dependencies", getCacheDir("library_dependencies"))
 
 
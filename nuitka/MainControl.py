@@ -106,6 +106,14 @@ from .build.SconsInterface import (
     setCommonSconsOptions,
 )
 from .code_generation import CodeGeneration, LoaderCodes, Reports
+from .code_generation.ModuleCodeCaching import (
+    generateModuleCodeCached,
+    reportModuleCodeCacheUsage,
+)
+from .code_generation.ParallelCodeGeneration import (
+    generateModulesCodeInWorkers,
+    shallUseCodeGenerationWorkers,
+)
 from .finalizations import Finalization
 from .freezer.Onefile import getCompressorPython, packDistFolderToOnefile
 from .freezer.Standalone import (
@@ -430,24 +438,42 @@ def makeSourceDirectory():
         total=len(compiled_modules),
     )
 
-    # Generate code for compiled modules, this can be slow, so do it separately
-    # with a progress bar.
-    for module in compiled_modules:
-        c_filename = module_filenames[module]
+    module_data_filenames = dict(
+        (module, os.path.basename(module_filenames[module][:-2] + ".const"))
+        for module in compiled_modules
+    )
 
+    def onModuleCode(module, source_code):
         reportProgressBar(
             item=module.getFullName(),
         )
 
-        source_code = CodeGeneration.generateModuleCode(
+        writeSourceCode(filename=module_filenames[module], source_code=source_code)
+
+    # Generate code for compiled modules, this can be slow, so do it separately
+    # with a progress bar, and if allowed, in worker processes, where modules
+    # that fail there, are done here too.
+    if shallUseCodeGenerationWorkers(compiled_modules):
+        remaining_modules = generateModulesCodeInWorkers(
+            modules=compiled_modules,
+            module_data_filenames=module_data_filenames,
+            on_module_code=onModuleCode,
+        )
+    else:
+        remaining_modules = compiled_modules
+
+    for module in remaining_modules:
+        source_code = generateModuleCodeCached(
             module=module,
-            data_filename=os.path.basename(c_filename[:-2] + ".const"),
+            data_filename=module_data_filenames[module],
         )
 
-        writeSourceCode(filename=c_filename, source_code=source_code)
+        onModuleCode(module=module, source_code=source_code)
 
     closeProgressBar()
 
+    reportModuleCodeCacheUsage(modules_count=len(compiled_modules))
+
     (
         helper_decl_code,
         helper_impl_code,
@@ -602,6 +628,12 @@ def runSconsBackend():
     if Options.isLowMemory():
         options["low_memory"] = asBoolStr(True)
 
+    if Options.isUnityBuild():
+        options["unity_build"] = asBoolStr(True)
+
+    if not Options.shallUsePrecompiledHeader():
+        options["disable_pch"] = asBoolStr(True)
+
     if not Options.shallMakeModule():
         options["result_exe"] = OutputDirectories.getResultFullpath(onefile=False)
 
@@ -649,6 +681,9 @@ def runSconsBackend():
     if Options.isProfile():
         options["profile_mode"] = asBoolStr(True)
 
+    if Options.isProfileSampling():
+        options["profile_sampling_mode"] = asBoolStr(True)
+
     if Options.shallTreatUninstalledPython():
         options["uninstalled_python"] = asBoolStr(True)
 
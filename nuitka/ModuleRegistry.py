@@ -165,6 +165,30 @@ def nextModule():
         return None
 
 
+def getActiveModules():
+    return tuple(active_modules)
+
+
+def replaceTraversedModule(old, new):
+    """Replace a module that is active or done in the current traversal."""
+
+    # Using global here, as this is really a singleton, in the form of a module,
+    # pylint: disable=global-statement
+    global active_modules
+
+    if old in active_modules:
+        active_modules = OrderedSet(
+            module if module is not old else new for module in active_modules
+        )
+    else:
+        done_modules.remove(old)
+        done_modules.add(new)
+
+    active_modules_info[new] = active_modules_info.pop(old)
+
+    new.startTraversal()
+
+
 def getRemainingModulesCount():
     return len(active_modules)
 
@@ -362,7 +362,21 @@ onefile_group.add_option(
     help="""\
 When creating the onefile, use an archive format, that can be unpacked
 with "nuitka-onefile-unpack" rather than a stream that only the onefile
-program itself unpacks. Default is off.""",
+program itself unpacks. Files are compressed separately in this format,
+which allows compressing and unpacking them in parallel on multiple
+cores. Default is off.""",
+)
+
+onefile_group.add_option(
+    "--onefile-cache-full-verify",
+    action="store_true",
+    dest="onefile_cache_full_verify",
+    default=False,
+    help="""\
+When the onefile tempdir spec makes it a cached location, always check
+the contents of already unpacked files. Otherwise a manifest written
+after unpacking is used, that only compares size and modification times
+of the files, if the payload is unchanged. Default is off.""",
 )
 
 del onefile_group
@@ -445,6 +459,22 @@ compilation. First files have to be specified as included somehow,
 then this refers to target paths. Default empty.""",
 )
 
+data_group.add_option(
+    "--embed-data-files",
+    action="append",
+    dest="data_files_embedded",
+    metavar="PATTERN",
+    default=[],
+    help="""\
+Embed the data files matching the filename pattern given into the binary
+rather than copying them. These are served from the loaded binary image by
+'get_data' of the loader, 'pkgutil.get_data', 'importlib.resources' and
+reading with 'open' in compiled code, without reading any files. This is
+against target filenames, not source paths, with the same matching as
+'--noinclude-data-files' does. Only for standalone and onefile mode.
+Default empty.""",
+)
+
 data_group.add_option(
     "--list-package-data",
     action="store",
@@ -655,6 +685,47 @@ deduce the value of "__package__", to be fully compatible. The value "original"
 is incompatible for modules that normally can be loaded into any package.""",
 )
 
+compilation_group.add_option(
+    "--lazy-constants",
+    action="store_true",
+    dest="lazy_constants",
+    default=False,
+    help="""\
+Unpack large constants, e.g. big tuples, dictionaries, or bytes values, only
+when the function using them is first executed, rather than when the module
+is loaded. This makes import time and memory usage of modules with large
+lookup tables scale with what is actually used. Defaults to off.""",
+)
+
+compilation_group.add_option(
+    "--optimization-jobs",
+    action="store",
+    dest="optimization_jobs",
+    metavar="N",
+    default=None,
+    help="""\
+Specify the allowed number of worker processes for optimization of modules
+that are included as bytecode, e.g. the standard library in standalone mode.
+These only need to be optimized to detect their imports, which are then
+exchanged through the bytecode cache. Negative values are system CPU minus
+the given value. Requires a platform with "fork". Defaults to 1, i.e. no
+worker processes are used.""",
+)
+
+compilation_group.add_option(
+    "--code-generation-jobs",
+    action="store",
+    dest="code_generation_jobs",
+    metavar="N",
+    default=None,
+    help="""\
+Specify the allowed number of worker processes for C code generation of
+compiled modules. Helper code and constants needed by the modules are then
+merged for the main process to create them. Negative values are system CPU
+minus the given value. Requires a platform with "fork". Defaults to 1, i.e.
+no worker processes are used.""",
+)
+
 
 del compilation_group
 
@@ -805,6 +876,22 @@ debug_group.add_option(
 Enable vmprof based profiling of time spent. Not working currently. Defaults to off.""",
 )
 
+debug_group.add_option(
+    "--profile-sampling",
+    action="store_true",
+    dest="profile_sampling",
+    default=False,
+    github_action=False,
+    help="""\
+Enable a built-in sampling profiler for the created program, that records
+the Python functions and lines of compiled and uncompiled code being run.
+At exit, it writes collapsed stacks, as used for flame graphs, to the file
+given by the environment variable NUITKA_PROFILE_OUTPUT, with default
+"nuitka-profile.collapsed". The sampling interval in microseconds of CPU
+time can be given with NUITKA_PROFILE_INTERVAL, default is 1000. Not
+available on Windows. Defaults to off.""",
+)
+
 debug_group.add_option(
     "--internal-graph",
     action="store_true",
@@ -977,6 +1064,30 @@ are system CPU minus the given value. Defaults to the full system CPU
 count unless low memory mode is activated, then it defaults to 1.""",
 )
 
+c_compiler_group.add_option(
+    "--unity-build",
+    action="store_true",
+    dest="unity_build",
+    default=False,
+    help="""\
+Compile the C code of modules grouped into as many unity source files as
+there are C compiler jobs, with sizes balanced. This avoids preparing the
+common headers for every module, which dominates the compile time of many
+small modules, and allows the C compiler to optimize across modules.
+Defaults to off.""",
+)
+
+c_compiler_group.add_option(
+    "--disable-precompiled-header",
+    action="store_true",
+    dest="disable_pch",
+    default=False,
+    help="""\
+Do not precompile the common header of all C files. With gcc, it is done
+once per compilation, and then used for every file compiled, if the C
+compiler options allow it. Defaults to off.""",
+)
+
 c_compiler_group.add_option(
     "--lto",
     action="store",
@@ -1021,9 +1132,9 @@ del c_compiler_group
 
 caching_group = parser.add_option_group("Cache Control")
 
-_cache_names = ("all", "ccache", "bytecode", "compression")
+_cache_names = ("all", "ccache", "bytecode", "compression", "code")
 
-if isWin32Windows():
+if not isMacOS():
     _cache_names += ("dll-dependencies",)
 
 caching_group.add_option(
@@ -1035,7 +1146,9 @@ caching_group.add_option(
     help="""\
 Disable selected caches, specify "all" for all cached. Currently allowed
 values are: %s. can be given multiple times or with comma separated values.
-Default none."""
+All caches are used by default, this includes the "code" cache, that keeps
+the generated C code of modules for re-use in later compilations. Default
+none."""
     % (",".join('"%s"' % cache_name for cache_name in _cache_names)),
 )
 
@@ -1077,14 +1190,14 @@ caching_group.add_option(
     help=SUPPRESS_HELP,
 )
 
-if isWin32Windows():
+if not isMacOS():
     caching_group.add_option(
         "--force-dll-dependency-cache-update",
         action="store_true",
         dest="update_dependency_cache",
         default=False,
         help="""\
-For an update of the dependency walker cache. Will result in much longer times
+For an update of the DLL dependency cache. Will result in much longer times
 to create the distribution folder, but might be used in case the cache is suspect
 to cause errors or known to need an update.
 """,
@@ -1044,6 +1044,22 @@ and recommended only for use in Nuitka development and testing."""
             % options.jobs
         )
 
+    try:
+        getOptimizationJobLimit()
+    except ValueError:
+        Tracing.options_logger.sysexit(
+            "For '--optimization-jobs' value, use integer values only, not '%s'."
+            % options.optimization_jobs
+        )
+
+    try:
+        getCodeGenerationJobLimit()
+    except ValueError:
+        Tracing.options_logger.sysexit(
+            "For '--code-generation-jobs' value, use integer values only, not '%s'."
+            % options.code_generation_jobs
+        )
+
     if isOnefileMode():
         standalone_mode = "onefile"
     elif isStandaloneMode():
@@ -1215,6 +1231,25 @@ console window for deployment.
             mnemonic="old-python-windows-console",
         )
 
+    if options.profile_sampling and isWin32Windows():
+        Tracing.options_logger.sysexit(
+            "Error, the option '--profile-sampling' is not supported on Windows."
+        )
+
+    if options.profile_sampling and shallMakeModule():
+        Tracing.options_logger.sysexit(
+            """\
+Error, the option '--profile-sampling' is for programs only, extension \
+modules cannot control profiling of the process."""
+        )
+
+    if options.data_files_embedded and not isStandaloneMode():
+        Tracing.options_logger.sysexit(
+            """\
+Error, the option '--embed-data-files' is only supported in standalone \
+and onefile mode, where data files are located relative to the binary."""
+        )
+
     if shallMakeModule() and (getForcedStderrPath() or getForcedStdoutPath()):
         Tracing.general.warning(
             """\
@@ -1315,6 +1350,11 @@ def getModuleNameMode():
     return options.module_name_mode
 
 
+def shallUseLazyConstants():
+    """:returns: bool derived from ``--lazy-constants``"""
+    return options.lazy_constants
+
+
 def shallMakeModule():
     """:returns: bool derived from ``--module``"""
     return options.module_mode
@@ -1455,6 +1495,12 @@ def getShallIncludeExternallyDataFilePatterns():
     return options.data_files_external
 
 
+def getShallEmbedDataFilePatterns():
+    """*list*, items of ``--embed-data-files=``"""
+
+    return options.data_files_embedded
+
+
 def getShallNotIncludeDllFilePatterns():
     """*list*, items of ``--noinclude-dlls=``"""
 
@@ -1511,6 +1557,11 @@ def isProfile():
     return options.profile
 
 
+def isProfileSampling():
+    """:returns: bool derived from ``--profile-sampling``"""
+    return options.profile_sampling
+
+
 def shallCreateGraph():
     """:returns: bool derived from ``--internal-graph``"""
     return options.internal_graph
@@ -1709,6 +1760,38 @@ def getJobLimit():
     return result
 
 
+def _getWorkerJobLimit(jobs):
+    if jobs is None:
+        return 1
+
+    result = int(jobs)
+
+    if result <= 0:
+        result = max(1, getCPUCoreCount() + result)
+
+    return result
+
+
+def getOptimizationJobLimit():
+    """*int*, value of ``--optimization-jobs`` or 1"""
+    return _getWorkerJobLimit(options.optimization_jobs)
+
+
+def getCodeGenerationJobLimit():
+    """*int*, value of ``--code-generation-jobs`` or 1"""
+    return _getWorkerJobLimit(options.code_generation_jobs)
+
+
+def isUnityBuild():
+    """:returns: bool derived from ``--unity-build``"""
+    return options.unity_build
+
+
+def shallUsePrecompiledHeader():
+    """:returns: bool derived from ``--disable-precompiled-header``"""
+    return not options.disable_pch
+
+
 def getLtoMode():
     """:returns: bool derived from ``--lto``"""
     return options.lto
@@ -1774,6 +1857,11 @@ def shallDisableCompressionCacheUsage():
     return shallDisableCacheUsage("compression")
 
 
+def shallDisableCodeCacheUsage():
+    """:returns: bool derived from ``--disable-cache=code``"""
+    return shallDisableCacheUsage("code")
+
+
 def getWindowsConsoleMode():
     """:returns: str from ``--windows-console-mode``"""
     if options.disable_console is True:
@@ -1986,6 +2074,11 @@ def shallOnefileAsArchive():
     return options.onefile_as_archive
 
 
+def shallOnefileCacheFullVerify():
+    """*bool* = ``--onefile-cache-full-verify``"""
+    return options.onefile_cache_full_verify
+
+
 def _checkIconPaths(icon_paths):
     for icon_path in icon_paths:
         if not os.path.exists(icon_path):
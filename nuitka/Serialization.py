@@ -98,6 +98,21 @@ class BlobData(object):
         return "<nuitka.Serialization.BlobData %s>" % self.name
 
 
+class LazyConstantValue(object):
+    """Used to pickle constants that are only unpacked when first used."""
+
+    __slots__ = ("value",)
+
+    def __init__(self, value):
+        self.value = value
+
+    def getValue(self):
+        return self.value
+
+    def __repr__(self):
+        return "<nuitka.Serialization.LazyConstantValue %r>" % (self.value,)
+
+
 def _pickleAnonValues(pickler, value):
     if value in builtin_anon_values:
         pickler.save(BuiltinAnonValue(builtin_anon_values[value]))
@@ -150,6 +165,10 @@ class ConstantStreamWriter(object):
         self.pickle.dump(BlobData(data, name))
         self.count += 1
 
+    def addLazyConstantValue(self, constant_value):
+        self.pickle.dump(LazyConstantValue(constant_value))
+        self.count += 1
+
     def close(self):
         self.file.close()
 
@@ -263,15 +282,72 @@ class GlobalConstantAccessor(object):
         return len(self.constants)
 
 
+def _isLazyConstantValue(constant):
+    """Decide if a constant is large enough to be worth unpacking lazily."""
+
+    constant_type = type(constant)
+
+    if constant_type in (tuple, list, dict, set, frozenset):
+        return len(constant) >= 64
+    elif python_version >= 0x300 and constant_type in (bytes, bytearray):
+        return len(constant) >= 1024
+    else:
+        return False
+
+
 class ConstantAccessor(GlobalConstantAccessor):
+    __slots__ = ("lazy_constants",)
+
+    def __init__(self, data_filename, top_level_name, lazy_constants=False):
+        GlobalConstantAccessor.__init__(
+            self, data_filename=data_filename, top_level_name=top_level_name
+        )
+
+        # Constant codes of lazy constants to their lazy index, which is also
+        # the order the loader finds them in, None if not enabled.
+        self.lazy_constants = {} if lazy_constants else None
+
     def _getConstantCode(self, constant):
         constant_type = type(constant)
 
         if constant_type is tuple and not constant:
             return "const_tuple_empty"
 
+        if self.lazy_constants is not None and _isLazyConstantValue(constant):
+            return self._getLazyConstantCode(constant)
+
         return GlobalConstantAccessor._getConstantCode(self, constant)
 
+    def _getLazyConstantCode(self, constant):
+        key = "const_" + namifyConstant(constant)
+
+        if key not in self.constants:
+            self.constants.add(key)
+            self.constants_writer.addLazyConstantValue(constant)
+
+            is_new = True
+        else:
+            is_new = False
+
+        key = "%s[%d]" % (self.top_level_name, self.constants.index(key))
+
+        if is_new:
+            self.lazy_constants[key] = len(self.lazy_constants)
+
+        return key
+
+    def getLazyConstantIndex(self, constant_code):
+        if self.lazy_constants is None:
+            return None
+
+        return self.lazy_constants.get(constant_code)
+
+    def getLazyConstantsCount(self):
+        if self.lazy_constants is None:
+            return 0
+
+        return len(self.lazy_constants)
+
 
 #     Part of "Nuitka", an optimizing Python compiler that is compatible and
 #     integrates with CPython, but also works on its own.
@@ -243,6 +243,16 @@ class Variable(getMetaClassBase("Variable", require_slots=True)):
 
         return None
 
+    def getAssignNodes(self):
+        return [trace.getAssignNode() for trace in self.traces if trace.isAssignTrace()]
+
+    def hasDeletedTraces(self):
+        for trace in self.traces:
+            if trace.isDeletedTrace():
+                return True
+
+        return False
+
     def getTypeShapes(self):
         result = set()
 
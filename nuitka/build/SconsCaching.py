@@ -167,9 +167,14 @@ def enableCcache(
             setEnvironmentVariable(env, "CLCACHE_MEMCACHED", None)
 
         # We know the include files we created are safe to use.
-        setEnvironmentVariable(
-            env, "CCACHE_SLOPPINESS", "include_file_ctime,include_file_mtime"
-        )
+        ccache_sloppiness = "include_file_ctime,include_file_mtime"
+
+        # The precompiled header is created with the same defines for every
+        # compilation.
+        if env.pch_mode:
+            ccache_sloppiness += ",pch_defines,time_macros"
+
+        setEnvironmentVariable(env, "CCACHE_SLOPPINESS", ccache_sloppiness)
 
         # First check if it's not already supposed to be a ccache, then do nothing.
         cc_path = getExecutablePath(env.the_compiler, env=env)
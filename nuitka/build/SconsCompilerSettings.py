@@ -11,7 +11,9 @@ import re
 from nuitka.Tracing import scons_details_logger, scons_logger
 from nuitka.utils.Download import getCachedDownloadedMinGW64
 from nuitka.utils.FileOperations import (
+    changeFilenameExtension,
     getReportPath,
+    makePath,
     openTextFile,
     putTextFileContents,
 )
@@ -1010,6 +1012,70 @@ def reportCCompiler(env, context, output_func):
     )
 
 
+def enablePrecompiledHeader(env, source_files, module_mode, disable_pch):
+    """Precompile the prelude header, that all compiled C files include first.
+
+    Only gcc looks for a precompiled header on its own, next to the included
+    one, and the build directory comes first in the include path. It also
+    checks if it was created with matching options and defines, otherwise it
+    uses the header itself.
+    """
+
+    env.pch_mode = not disable_pch and env.gcc_mode and not env.clang_mode
+
+    if not env.pch_mode:
+        return
+
+    # Same as used for the compilation of the source files.
+    if env.c11_mode:
+        command = "$%(sh)sCC -o $TARGET -x c-header -c $%(sh)sCFLAGS $%(sh)sCCFLAGS"
+    else:
+        command = (
+            "$%(sh)sCXX -o $TARGET -x c++-header -c $%(sh)sCXXFLAGS $%(sh)sCCFLAGS"
+        )
+
+    command = command % {"sh": "SH" if module_mode else ""} + " $_CCCOMCOM $SOURCE"
+
+    # A header needs to exist next to it, gcc will include it from there when
+    # included again, where the include guard then makes it do nothing.
+    header_filename = os.path.join(env.source_dir, "nuitka", "prelude.h")
+    makePath(os.path.dirname(header_filename))
+    putTextFileContents(
+        header_filename,
+        contents='#include "%s"\n'
+        % os.path.abspath(
+            os.path.join(env.nuitka_src, "include", "nuitka", "prelude.h")
+        ).replace("\\", "/"),
+    )
+
+    from SCons.Scanner.C import (  # pylint: disable=I0021,import-error
+        CScanner,
+    )
+
+    pch_node = env.Command(
+        header_filename + ".gch",
+        header_filename,
+        command,
+        source_scanner=CScanner(),
+    )
+
+    # The object files need to be created with it.
+    object_suffix = env.subst("$SHOBJSUFFIX" if module_mode else "$OBJSUFFIX")
+
+    env.Depends(
+        [
+            changeFilenameExtension(source_file, object_suffix)
+            for source_file in source_files
+        ],
+        pch_node,
+    )
+
+    # For ccache to be able to use it, spell-checker: ignore fpch
+    env.Append(CCFLAGS=["-fpch-preprocess"])
+
+    scons_details_logger.info("Using precompiled header for 'nuitka/prelude.h'.")
+
+
 def importEnvironmentVariableSettings(env):
     """Import typical environment variables that compilation should use."""
     # spell-checker: ignore cppflags,cflags,ccflags,cxxflags,ldflags
@@ -432,6 +432,7 @@ def cleanSconsDirectory(source_dir):
         ".txt",
         ".const",
         ".gcda",
+        ".gch",
         ".pgd",
         ".pgc",
     )
@@ -456,6 +457,12 @@ def cleanSconsDirectory(source_dir):
             for path, _filename in listDir(plugins_dir):
                 check(path)
 
+        pch_dir = os.path.join(source_dir, "nuitka")
+
+        if os.path.exists(pch_dir):
+            for path, _filename in listDir(pch_dir):
+                check(path)
+
 
 def setCommonSconsOptions(options):
     # Scons gets transported many details, that we express as variables, and
@@ -9,6 +9,7 @@ from __future__ import print_function
 
 import os
 import pickle
+import re
 import shutil
 import signal
 import sys
@@ -21,11 +22,13 @@ from nuitka.utils.FileOperations import (
     changeFilenameExtension,
     getFileContentByLine,
     getFilenameExtension,
+    getFileSize,
     getWindowsShortPathName,
     hasFilenameExtension,
     isFilesystemEncodable,
     openPickleFile,
     openTextFile,
+    putTextFileContents,
     withFileLock,
 )
 from nuitka.utils.Utils import isLinux, isMacOS, isPosixWindows, isWin32Windows
@@ -262,6 +265,9 @@ def createEnvironment(
     # Modules count, determines if this is a large compilation.
     env.module_count = getArgumentInt("module_count", 0)
 
+    # Precompiled header usage, decided for compiled modules only.
+    env.pch_mode = False
+
     # Target arch for some decisions
     env.target_arch = target_arch
 
@@ -647,6 +653,94 @@ def scanSourceDir(env, dirname, plugins):
             yield target_filename
 
 
+# Definitions of file level static variables and functions with fixed names in
+# the module code templates, these would clash when multiple modules are
+# compiled as one. Names made from template values are unique already.
+_static_definition_regex = re.compile(
+    r"^(?:NUITKA_MAY_BE_UNUSED\s+)?static\s+[^=;{]*?(?<![\w%)])([A-Za-z_]\w*)\s*(?:\[[^\]]*\]\s*)?[=;(]",
+    re.M,
+)
+
+
+_module_code_static_names = None
+
+
+def _getModuleCodeStaticNames():
+    # singleton, pylint: disable=global-statement
+    global _module_code_static_names
+
+    if _module_code_static_names is None:
+        # Late import, code generation is otherwise not needed in Scons.
+        from nuitka.code_generation.templates import CodeTemplatesModules
+
+        result = set()
+
+        for template_name, template in vars(CodeTemplatesModules).items():
+            if template_name.startswith("template_") and isinstance(
+                template, basestring
+            ):
+                result.update(_static_definition_regex.findall(template))
+
+        _module_code_static_names = tuple(sorted(result))
+
+    return _module_code_static_names
+
+
+def makeUnitySourceFiles(env, source_files, job_count):
+    """Replace module source files with unity source files including them.
+
+    There are as many as there are jobs, with balanced sizes. The contents
+    only depend on the included files, so C compiler caches remain usable.
+    """
+
+    module_source_files = []
+    result = []
+
+    for source_file in source_files:
+        if os.path.basename(source_file).startswith("module."):
+            module_source_files.append(source_file)
+        else:
+            result.append(source_file)
+
+    unity_count = min(job_count or 1, len(module_source_files))
+
+    unity_source_files = [[] for _unity_index in range(unity_count)]
+    unity_sizes = [0] * unity_count
+
+    # Give the largest files out first, always to the smallest unity file.
+    for source_file in sorted(
+        module_source_files,
+        key=lambda source_file: (-getFileSize(source_file), source_file),
+    ):
+        unity_index = unity_sizes.index(min(unity_sizes))
+
+        unity_source_files[unity_index].append(source_file)
+        unity_sizes[unity_index] += getFileSize(source_file)
+
+    for unity_index, included_source_files in enumerate(unity_source_files):
+        lines = []
+
+        for include_index, source_file in enumerate(sorted(included_source_files)):
+            for name in _getModuleCodeStaticNames():
+                lines.append("#define %s %s_%d" % (name, name, include_index))
+
+            lines.append('#include "%s"' % os.path.basename(source_file))
+
+            for name in _getModuleCodeStaticNames():
+                lines.append("#undef %s" % name)
+
+        unity_filename = os.path.join(
+            env.source_dir,
+            "unity_modules_%d.%s" % (unity_index + 1, "c" if env.c11_mode else "cpp"),
+        )
+
+        putTextFileContents(filename=unity_filename, contents=lines)
+
+        result.append(unity_filename)
+
+    return result
+
+
 def makeCLiteral(value):
     value = value.replace("\\", r"\\")
     value = value.replace('"', r"\"")
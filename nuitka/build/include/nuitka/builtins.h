@@ -44,6 +44,48 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_BUILTIN_STR(char const *name) {
     return result;
 }
 
+// Inline cache for module variable reads, one per access site. It holds the
+// dictionary slot the value was found in, which stays valid as long as the
+// version tags of the module dictionary, and if it came from there, of the
+// built-in dictionary, are unchanged. Our own in-place updates of existing
+// values do not change the version tag, but they write to the slot, so reading
+// through it gives the current value.
+#if PYTHON_VERSION >= 0x360 && PYTHON_VERSION < 0x3c0 && !defined(PY_NOGIL)
+#define NUITKA_MODULE_VALUE_CACHE 1
+#else
+#define NUITKA_MODULE_VALUE_CACHE 0
+#endif
+
+struct Nuitka_ModuleValueCache {
+    PyObject **value_slot;
+
+    uint64_t module_dict_version;
+    // Zero, if the value was found in the module dictionary.
+    uint64_t builtins_dict_version;
+};
+
+NUITKA_MAY_BE_UNUSED static PyObject *GET_MODULE_VALUE_CACHED(PyDictObject *module_dict,
+                                                              struct Nuitka_ModuleValueCache *cache) {
+#if NUITKA_MODULE_VALUE_CACHE
+    if (likely(module_dict->ma_version_tag == cache->module_dict_version)) {
+        if (likely(cache->builtins_dict_version == 0 ||
+                   dict_builtin->ma_version_tag == cache->builtins_dict_version)) {
+            return *cache->value_slot;
+        }
+    }
+#endif
+
+    return NULL;
+}
+
+// Slow path of "GET_MODULE_VALUE_CACHED", does the full lookup and updates the cache.
+extern PyObject *LOOKUP_MODULE_VALUE_CACHE_FALLBACK(PyDictObject *module_dict, PyObject *var_name,
+                                                    struct Nuitka_ModuleValueCache *cache);
+// Same, but raises "NameError" if the variable is not found.
+extern PyObject *GET_MODULE_VARIABLE_VALUE_CACHE_FALLBACK(PyThreadState *tstate, PyDictObject *module_dict,
+                                                          PyObject *variable_name,
+                                                          struct Nuitka_ModuleValueCache *cache);
+
 extern void _initBuiltinModule(void);
 
 #define NUITKA_DECLARE_BUILTIN(name) extern PyObject *_python_original_builtin_value_##name;
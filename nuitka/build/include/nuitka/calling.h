@@ -105,6 +105,45 @@ extern void formatCannotInstantiateAbstractClass(PyThreadState *tstate, PyTypeOb
 
 #include "nuitka/helper/calling_generated.h"
 
+// Inline cache of method calls with a constant attribute name, one per call
+// site. The attribute found in the type is held without a reference, it is
+// guarded by the type version tag, which changes with every modification of
+// the dictionaries in the MRO, and therefore before it could be released.
+#if PYTHON_VERSION >= 0x380 && !defined(PY_NOGIL) && !defined(_NUITKA_EXPERIMENTAL_DISABLE_ATTR_OPT)
+#define NUITKA_METHOD_CALL_CACHE 1
+#else
+#define NUITKA_METHOD_CALL_CACHE 0
+#endif
+
+enum Nuitka_MethodCallCacheKind {
+    METHOD_CALL_CACHE_EMPTY,
+    // Compiled function, called with the source object as "self".
+    METHOD_CALL_CACHE_COMPILED_FUNCTION,
+    // Method descriptor or uncompiled function, called with the source
+    // object prepended to the arguments.
+    METHOD_CALL_CACHE_UNBOUND,
+    // Built-in function, not a descriptor, called without the source object.
+    METHOD_CALL_CACHE_CFUNCTION
+};
+
+struct Nuitka_MethodCallCache {
+    PyTypeObject *type;
+    unsigned int type_version_tag;
+    enum Nuitka_MethodCallCacheKind kind;
+    PyObject *descr;
+};
+
+// Method call variants using a call site cache, falling back to the
+// "CALL_METHOD_*" helpers for the uncached cases.
+extern PyObject *CALL_METHOD_NO_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                            struct Nuitka_MethodCallCache *cache);
+extern PyObject *CALL_METHOD_WITH_SINGLE_ARG_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                                    PyObject *arg, struct Nuitka_MethodCallCache *cache);
+// Only for up to 10 arguments, the pre-generated "CALL_METHOD_WITH_ARGS*" helpers.
+extern PyObject *CALL_METHOD_WITH_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                              PyObject *const *args, Py_ssize_t args_count,
+                                              struct Nuitka_MethodCallCache *cache);
+
 #endif
 
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
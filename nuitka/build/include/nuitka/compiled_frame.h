@@ -128,6 +128,11 @@ struct Nuitka_FrameObject {
 
 #endif
 
+    // Idle frames of a function are kept in a list by its frame cache, with
+    // the number of frames following in it.
+    struct Nuitka_FrameObject *m_cache_next;
+    int m_cache_depth;
+
     // Our own extra stuff, attached variables.
     char const *m_type_description;
     char m_locals_storage[1];
@@ -166,6 +171,67 @@ extern int count_released_frame_cache_instances;
 extern int count_hit_frame_cache_instances;
 #endif
 
+// Functions keep their idle frames for reuse, as a list per code site, such
+// that recursive and threaded calls need not create new frames each time. These
+// frames are only referenced by the list, so they cannot be observed, and are
+// already tracked by the garbage collector. Without the GIL, the list cannot be
+// shared by threads, and the per thread free lists have to do.
+#define NUITKA_FRAME_CACHE_MAX_DEPTH 128
+
+NUITKA_MAY_BE_UNUSED static inline struct Nuitka_FrameObject *
+takeFrameFromCache(struct Nuitka_FrameObject **frame_cache) {
+#ifdef Py_GIL_DISABLED
+    return NULL;
+#else
+    struct Nuitka_FrameObject *frame_object = *frame_cache;
+
+    if (likely(frame_object != NULL)) {
+        assert(Py_REFCNT(frame_object) == 1);
+        assert(frame_object->m_frame.f_back == NULL);
+        assert(frame_object->m_type_description == NULL);
+
+        *frame_cache = frame_object->m_cache_next;
+        frame_object->m_cache_next = NULL;
+
+#if PYTHON_VERSION < 0x340
+        // Might have been last used by another thread.
+        frame_object->m_frame.f_tstate = PyThreadState_GET();
+#endif
+    }
+
+    return frame_object;
+#endif
+}
+
+// Give up the reference to a frame no longer executing, it goes back to the
+// cache unless it was observed, e.g. by a traceback or "sys._getframe()".
+NUITKA_MAY_BE_UNUSED static inline void releaseFrameToCache(struct Nuitka_FrameObject **frame_cache,
+                                                            struct Nuitka_FrameObject *frame_object) {
+    CHECK_OBJECT(frame_object);
+
+#ifndef Py_GIL_DISABLED
+    if (Py_REFCNT(frame_object) == 1 && frame_object->m_frame.f_back == NULL &&
+        frame_object->m_type_description == NULL) {
+        struct Nuitka_FrameObject *next = *frame_cache;
+        int depth = next != NULL ? next->m_cache_depth + 1 : 0;
+
+        if (likely(depth < NUITKA_FRAME_CACHE_MAX_DEPTH)) {
+            frame_object->m_cache_next = next;
+            frame_object->m_cache_depth = depth;
+
+            *frame_cache = frame_object;
+            return;
+        }
+    }
+#endif
+
+#if _DEBUG_REFCOUNTS
+    count_released_frame_cache_instances += 1;
+#endif
+
+    Py_DECREF(frame_object);
+}
+
 #if _DEBUG_FRAME
 extern void dumpFrameStack(void);
 #endif
@@ -483,6 +549,8 @@ NUITKA_MAY_BE_UNUSED inline static void pushFrameStackGeneratorCompiledFrame(PyT
 #define NUITKA_TYPE_DESCRIPTION_OBJECT 'o'
 #define NUITKA_TYPE_DESCRIPTION_OBJECT_PTR 'O'
 #define NUITKA_TYPE_DESCRIPTION_BOOL 'b'
+#define NUITKA_TYPE_DESCRIPTION_FLOAT 'f'
+#define NUITKA_TYPE_DESCRIPTION_ILONG 'L'
 
 #if _DEBUG_REFCOUNTS
 extern int count_active_Nuitka_Frame_Type;
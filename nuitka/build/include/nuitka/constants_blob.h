@@ -14,7 +14,11 @@
  *
  */
 
-extern void loadConstantsBlob(PyThreadState *tstate, PyObject **, char const *name);
+extern void loadConstantsBlob(PyThreadState *tstate, PyObject **, unsigned char const **lazy_output,
+                              char const *name);
+
+// Unpack a constant that loading the blob has only recorded the data of.
+extern void loadLazyConstant(PyThreadState *tstate, PyObject **output, unsigned char const *data);
 
 #endif
 
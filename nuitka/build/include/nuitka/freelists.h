@@ -13,12 +13,12 @@ static const bool use_freelists = false;
 static const bool use_freelists = true;
 #endif
 
-#define allocateFromFreeList(free_list, object_type, type_type, size)                                                  \
+#define _allocateFromFreeList(free_list, free_list_count, object_type, type_type, size)                                \
     if (free_list != NULL) {                                                                                           \
         result = free_list;                                                                                            \
         free_list = *((object_type **)free_list);                                                                      \
-        free_list##_count -= 1;                                                                                        \
-        assert(free_list##_count >= 0);                                                                                \
+        free_list_count -= 1;                                                                                          \
+        assert(free_list_count >= 0);                                                                                  \
                                                                                                                        \
         if (Py_SIZE(result) < size) {                                                                                  \
             result = PyObject_GC_Resize(object_type, result, size);                                                    \
@@ -31,12 +31,12 @@ static const bool use_freelists = true;
     }                                                                                                                  \
     CHECK_OBJECT(result);
 
-#define allocateFromFreeListFixed(free_list, object_type, type_type)                                                   \
+#define _allocateFromFreeListFixed(free_list, free_list_count, object_type, type_type)                                 \
     if (free_list != NULL) {                                                                                           \
         result = free_list;                                                                                            \
         free_list = *((object_type **)free_list);                                                                      \
-        free_list##_count -= 1;                                                                                        \
-        assert(free_list##_count >= 0);                                                                                \
+        free_list_count -= 1;                                                                                          \
+        assert(free_list_count >= 0);                                                                                  \
                                                                                                                        \
         Nuitka_Py_NewReference((PyObject *)result);                                                                    \
     } else {                                                                                                           \
@@ -44,24 +44,113 @@ static const bool use_freelists = true;
     }                                                                                                                  \
     CHECK_OBJECT(result);
 
-#define releaseToFreeList(free_list, object, max_free_list_count)                                                      \
+#define _releaseToFreeList(free_list, free_list_count, object, max_free_list_count)                                    \
     if (free_list != NULL || max_free_list_count == 0 || use_freelists == false) {                                     \
-        if (free_list##_count >= max_free_list_count) {                                                                \
+        if (free_list_count >= max_free_list_count) {                                                                  \
             PyObject_GC_Del(object);                                                                                   \
         } else {                                                                                                       \
             *((void **)object) = (void *)free_list;                                                                    \
             free_list = object;                                                                                        \
                                                                                                                        \
-            free_list##_count += 1;                                                                                    \
+            free_list_count += 1;                                                                                      \
         }                                                                                                              \
     } else {                                                                                                           \
         free_list = object;                                                                                            \
         *((void **)object) = NULL;                                                                                     \
                                                                                                                        \
-        assert(free_list##_count == 0);                                                                                \
+        assert(free_list_count == 0);                                                                                  \
                                                                                                                        \
-        free_list##_count += 1;                                                                                        \
+        free_list_count += 1;                                                                                          \
+    }
+
+#ifdef Py_GIL_DISABLED
+// Without the GIL, the free lists cannot be shared by threads. Every thread
+// has its own, these are attached to its thread state on first release, and
+// emptied when that is cleared. Objects released by other threads than the
+// one that created them, go to the list of the releasing thread, within the
+// same limits, so no list grows beyond its maximum.
+struct Nuitka_FrameObject;
+struct Nuitka_FunctionObject;
+struct Nuitka_MethodObject;
+struct Nuitka_CellObject;
+struct Nuitka_GeneratorObject;
+struct Nuitka_CoroutineObject;
+struct Nuitka_CoroutineWrapperObject;
+struct Nuitka_AIterWrapper;
+struct Nuitka_AsyncgenObject;
+struct Nuitka_AsyncgenWrappedValueObject;
+struct Nuitka_AsyncgenAsendObject;
+struct Nuitka_AsyncgenAthrowObject;
+struct Nuitka_LoaderObject;
+
+struct Nuitka_ThreadFreeLists {
+    // The thread state the lists are attached to, NULL if not attached.
+    PyThreadState *tstate;
+    // The thread state that released them, not to attach to it again.
+    PyThreadState *released_tstate;
+
+    struct Nuitka_FrameObject *free_list_frames;
+    int free_list_frames_count;
+    struct Nuitka_FunctionObject *free_list_functions;
+    int free_list_functions_count;
+    struct Nuitka_MethodObject *free_list_methods;
+    int free_list_methods_count;
+    struct Nuitka_CellObject *free_list_cells;
+    int free_list_cells_count;
+    struct Nuitka_GeneratorObject *free_list_generators;
+    int free_list_generators_count;
+    struct Nuitka_CoroutineObject *free_list_coros;
+    int free_list_coros_count;
+    struct Nuitka_CoroutineWrapperObject *free_list_coro_wrappers;
+    int free_list_coro_wrappers_count;
+    struct Nuitka_AIterWrapper *free_list_coroutine_aiter_wrappers;
+    int free_list_coroutine_aiter_wrappers_count;
+    struct Nuitka_AsyncgenObject *free_list_asyncgens;
+    int free_list_asyncgens_count;
+    struct Nuitka_AsyncgenWrappedValueObject *free_list_asyncgen_value_wrappers;
+    int free_list_asyncgen_value_wrappers_count;
+    struct Nuitka_AsyncgenAsendObject *free_list_asyncgen_asends;
+    int free_list_asyncgen_asends_count;
+    struct Nuitka_AsyncgenAthrowObject *free_list_asyncgen_athrows;
+    int free_list_asyncgen_athrows_count;
+    PyTracebackObject *free_list_tracebacks;
+    int free_list_tracebacks_count;
+    struct Nuitka_LoaderObject *free_list_loaders;
+    int free_list_loaders_count;
+};
+
+extern _Thread_local struct Nuitka_ThreadFreeLists Nuitka_thread_free_lists;
+
+// Attach the free lists of the current thread to its thread state, false if
+// that is not possible, and objects must not be put into them.
+extern bool Nuitka_AttachThreadFreeLists(PyThreadState *tstate);
+
+#define allocateFromFreeList(free_list, object_type, type_type, size)                                                  \
+    _allocateFromFreeList(Nuitka_thread_free_lists.free_list, Nuitka_thread_free_lists.free_list##_count, object_type, \
+                          type_type, size)
+
+#define allocateFromFreeListFixed(free_list, object_type, type_type)                                                   \
+    _allocateFromFreeListFixed(Nuitka_thread_free_lists.free_list, Nuitka_thread_free_lists.free_list##_count,        \
+                               object_type, type_type)
+
+#define releaseToFreeList(free_list, object, max_free_list_count)                                                      \
+    if (likely(Nuitka_thread_free_lists.tstate == PyThreadState_GET()) ||                                              \
+        Nuitka_AttachThreadFreeLists(PyThreadState_GET())) {                                                           \
+        _releaseToFreeList(Nuitka_thread_free_lists.free_list, Nuitka_thread_free_lists.free_list##_count, object,     \
+                           max_free_list_count)                                                                        \
+    } else {                                                                                                           \
+        PyObject_GC_Del(object);                                                                                       \
     }
+#else
+#define allocateFromFreeList(free_list, object_type, type_type, size)                                                  \
+    _allocateFromFreeList(free_list, free_list##_count, object_type, type_type, size)
+
+#define allocateFromFreeListFixed(free_list, object_type, type_type)                                                   \
+    _allocateFromFreeListFixed(free_list, free_list##_count, object_type, type_type)
+
+#define releaseToFreeList(free_list, object, max_free_list_count)                                                      \
+    _releaseToFreeList(free_list, free_list##_count, object, max_free_list_count)
+#endif
 
 #if PYTHON_VERSION >= 0x3d0
 NUITKA_MAY_BE_UNUSED static inline struct _Py_object_freelists *_Nuitka_object_freelists_GET(PyThreadState *tstate) {
@@ -24,6 +24,46 @@ extern int HAS_ATTR_BOOL2(PyThreadState *tstate, PyObject *source, PyObject *att
 // Set an attribute except for attribute slots below.
 extern bool SET_ATTRIBUTE(PyThreadState *tstate, PyObject *target, PyObject *attr_name, PyObject *value);
 
+// Inline cache of attribute lookups and assignments with a constant attribute
+// name, one per code site. Like the method call cache, it is guarded by the
+// type version tag, and holds the attribute found in the type as a borrowed
+// reference.
+#if PYTHON_VERSION >= 0x380 && !defined(PY_NOGIL) && !defined(_NUITKA_EXPERIMENTAL_DISABLE_ATTR_OPT)
+#define NUITKA_ATTRIBUTE_CACHE 1
+#else
+#define NUITKA_ATTRIBUTE_CACHE 0
+#endif
+
+enum Nuitka_AttributeCacheKind {
+    ATTRIBUTE_CACHE_EMPTY,
+    // Object member of the type, e.g. from "__slots__", at the cached offset.
+    ATTRIBUTE_CACHE_MEMBER,
+    // Other data descriptor of the type, e.g. a "property".
+    ATTRIBUTE_CACHE_DATA_DESCRIPTOR,
+    // Instance dictionary first, then the attribute of the type, if any. For
+    // instance values, the index in the shared keys is cached.
+    ATTRIBUTE_CACHE_INSTANCE,
+    // Not handled by the cache for this type, use the uncached path directly.
+    ATTRIBUTE_CACHE_UNCACHEABLE
+};
+
+struct Nuitka_AttributeCache {
+    PyTypeObject *type;
+    unsigned int type_version_tag;
+    enum Nuitka_AttributeCacheKind kind;
+    PyObject *descr;
+    // Member offset, or index in the shared keys of the type, negative if
+    // not present there.
+    Py_ssize_t index;
+};
+
+// Attribute lookup and assignment using a code site cache, falling back to
+// "LOOKUP_ATTRIBUTE" and "SET_ATTRIBUTE" for uncached cases.
+extern PyObject *LOOKUP_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                         struct Nuitka_AttributeCache *cache);
+extern bool SET_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *target, PyObject *attr_name, PyObject *value,
+                                 struct Nuitka_AttributeCache *cache);
+
 // Set the "__dict__" special attribute slot.
 extern bool SET_ATTRIBUTE_DICT_SLOT(PyThreadState *tstate, PyObject *target, PyObject *value);
 
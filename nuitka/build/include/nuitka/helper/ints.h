@@ -41,7 +41,8 @@ typedef struct {
     long long_value;
 } nuitka_long;
 
-#if PYTHON_VERSION < 0x300
+// Used for Python2 "int or long" values, and for values of loops over ranges,
+// where the C value is known, and the object is only created when needed.
 typedef enum {
     NUITKA_ILONG_UNASSIGNED = 0,
     NUITKA_ILONG_OBJECT_VALID = 1,
@@ -56,17 +57,42 @@ typedef struct {
     long ilong_value;
 } nuitka_ilong;
 
+// For initialization, also of storage where no initializer can be used.
+NUITKA_MAY_BE_UNUSED static nuitka_ilong MAKE_ILONG_UNASSIGNED(void) {
+    nuitka_ilong result = {NUITKA_ILONG_UNASSIGNED, NULL, 0};
+    return result;
+}
+
 NUITKA_MAY_BE_UNUSED static void ENFORCE_ILONG_OBJECT_VALUE(nuitka_ilong *value) {
     assert(value->validity != NUITKA_ILONG_UNASSIGNED);
 
     if ((value->validity & NUITKA_ILONG_OBJECT_VALID) == 0) {
-        value->ilong_object = Nuitka_PyLong_FromLong(value->ilong_value);
+        value->ilong_object = Nuitka_PyInt_FromLong(value->ilong_value);
 
         value->validity = NUITKA_ILONG_BOTH_VALID;
     }
 }
 
-#endif
+// Compare an "int or long" value with a C long, giving -1, 0 or 1 like "strcmp",
+// cannot fail, values not fitting into C long are smaller or larger.
+NUITKA_MAY_BE_UNUSED static int COMPARE_ILONG_CLONG(nuitka_ilong const *value, long other) {
+    assert(value->validity != NUITKA_ILONG_UNASSIGNED);
+
+    long value_long;
+
+    if ((value->validity & NUITKA_ILONG_VALUE_VALID) != 0) {
+        value_long = value->ilong_value;
+    } else {
+        int overflow;
+        value_long = PyLong_AsLongAndOverflow(value->ilong_object, &overflow);
+
+        if (overflow != 0) {
+            return overflow;
+        }
+    }
+
+    return value_long < other ? -1 : (value_long > other ? 1 : 0);
+}
 
 #if PYTHON_VERSION < 0x3c0
 // Convert single digit to sdigit (int32_t)
@@ -40,6 +40,13 @@ extern void LIST_CLEAR(PyObject *target);
 // Like list.reverse
 extern void LIST_REVERSE(PyObject *list);
 
+#if PYTHON_VERSION >= 0x300
+// Like list.sort, key may be NULL for LIST_SORT3
+extern PyObject *LIST_SORT1(PyThreadState *tstate, PyObject *list);
+extern PyObject *LIST_SORT2(PyThreadState *tstate, PyObject *list, PyObject *key);
+extern PyObject *LIST_SORT3(PyThreadState *tstate, PyObject *list, PyObject *key, PyObject *reverse);
+#endif
+
 // Like list.copy
 extern PyObject *LIST_COPY(PyThreadState *tstate, PyObject *list);
 
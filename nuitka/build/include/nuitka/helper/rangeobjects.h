@@ -48,6 +48,79 @@ extern PyObject *MAKE_XRANGE(PyThreadState *tstate, long start, long stop, long
 
 #endif
 
+// State of a "for" loop over a range. If all values of the range fit into C
+// "long", the iteration is done in C, otherwise a normal iterator is used.
+typedef struct {
+    PyObject *iterator;
+
+    long value;
+    long step;
+    long remaining;
+} nuitka_range_iter;
+
+// For initialization, also of storage where no initializer can be used.
+NUITKA_MAY_BE_UNUSED static nuitka_range_iter MAKE_RANGE_ITER_UNASSIGNED(void) {
+    nuitka_range_iter result = {NULL, 0, 0, -1};
+    return result;
+}
+
+extern bool MAKE_RANGE_LOOP_ITERATOR(PyThreadState *tstate, nuitka_range_iter *iter, PyObject *range);
+
+NUITKA_MAY_BE_UNUSED static bool _ITERATE_RANGE_LOOP_CLONG(nuitka_range_iter *iter, long *result) {
+    assert(iter->iterator == NULL);
+
+    if (iter->remaining == 0) {
+        return false;
+    }
+
+    *result = iter->value;
+
+    // Unsigned, so that stepping past the last value cannot overflow.
+    iter->value = (long)((unsigned long)iter->value + (unsigned long)iter->step);
+    iter->remaining -= 1;
+
+    return true;
+}
+
+// Next value of the range loop as an object, NULL if exhausted or an
+// exception occurred.
+NUITKA_MAY_BE_UNUSED static PyObject *ITERATE_RANGE_LOOP(nuitka_range_iter *iter) {
+    if (likely(iter->iterator == NULL)) {
+        long value;
+
+        if (_ITERATE_RANGE_LOOP_CLONG(iter, &value) == false) {
+            return NULL;
+        }
+
+        return Nuitka_PyInt_FromLong(value);
+    } else {
+        return ITERATOR_NEXT_ITERATOR(iter->iterator);
+    }
+}
+
+// Next value of the range loop, without creating an object if possible,
+// false if exhausted or an exception occurred.
+NUITKA_MAY_BE_UNUSED static bool ITERATE_RANGE_LOOP_ILONG(nuitka_range_iter *iter, nuitka_ilong *result) {
+    if (likely(iter->iterator == NULL)) {
+        if (_ITERATE_RANGE_LOOP_CLONG(iter, &result->ilong_value) == false) {
+            return false;
+        }
+
+        result->validity = NUITKA_ILONG_VALUE_VALID;
+    } else {
+        PyObject *value = ITERATOR_NEXT_ITERATOR(iter->iterator);
+
+        if (value == NULL) {
+            return false;
+        }
+
+        result->validity = NUITKA_ILONG_OBJECT_VALID;
+        result->ilong_object = value;
+    }
+
+    return true;
+}
+
 #endif
 
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
@@ -8,6 +8,10 @@ extern PyObject *STR_JOIN(PyThreadState *tstate, PyObject *str, PyObject *iterab
 #endif
 
 extern PyObject *UNICODE_JOIN(PyThreadState *tstate, PyObject *str, PyObject *iterable);
+#if PYTHON_VERSION >= 0x300
+// Join an array of str values, with no separator, e.g. for f-strings.
+extern PyObject *UNICODE_JOIN_ARRAY(PyThreadState *tstate, PyObject *const *items, Py_ssize_t count);
+#endif
 extern PyObject *UNICODE_PARTITION(PyThreadState *tstate, PyObject *str, PyObject *sep);
 extern PyObject *UNICODE_RPARTITION(PyThreadState *tstate, PyObject *str, PyObject *sep);
 
@@ -78,6 +78,12 @@ extern void startProfiling(void);
 extern void stopProfiling(void);
 #endif
 
+// For the built-in sampling profiler of Nuitka compiled binaries.
+#if _NUITKA_PROFILE_SAMPLING
+extern void startSamplingProfiler(void);
+extern void stopSamplingProfiler(void);
+#endif
+
 #include "nuitka/helper/boolean.h"
 #include "nuitka/helper/dictionaries.h"
 #include "nuitka/helper/indexes.h"
@@ -175,6 +181,25 @@ extern PyObject *OS_PATH_FILE_ISDIR(PyThreadState *tstate, PyObject *filename);
 // Small helper to list a directory.
 extern PyObject *OS_LISTDIR(PyThreadState *tstate, PyObject *path);
 
+// Data files embedded into the binary, looked up by their full path, NULL
+// if not embedded, without an exception set.
+struct Nuitka_EmbeddedDataFileEntry;
+extern struct Nuitka_EmbeddedDataFileEntry const *findEmbeddedDataFile(PyThreadState *tstate, PyObject *filename);
+extern PyObject *getEmbeddedDataFileBytes(struct Nuitka_EmbeddedDataFileEntry const *data_file);
+#if PYTHON_VERSION >= 0x300
+// Read only view of the contents, without copying them.
+extern PyObject *getEmbeddedDataFileMemoryView(struct Nuitka_EmbeddedDataFileEntry const *data_file);
+#endif
+
+// Names of embedded data files and directories directly inside of a directory
+// given by full path, NULL if there are none, without an exception set.
+extern PyObject *getEmbeddedDataDirectoryNames(PyThreadState *tstate, PyObject *path);
+
+// Open embedded data files for reading, returns false if not to be served
+// from the embedded contents, then a normal open is needed.
+extern bool OPEN_EMBEDDED_DATA_FILE(PyThreadState *tstate, PyObject *file_name, PyObject *mode, PyObject *encoding,
+                                    PyObject *errors, PyObject *newline, PyObject **result);
+
 // Platform standard slash for filenames
 #if defined(_WIN32)
 #define const_platform_sep const_str_backslash
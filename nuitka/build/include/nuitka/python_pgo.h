@@ -28,6 +28,10 @@ extern void PGO_onProbePassed(char const *module_name, char const *probe_id, uin
 
 extern void PGO_onTechnicalModule(char const *module_name);
 
+// When an operation site is passed, with the types of its operands, the second
+// one may be NULL, for operations with only one.
+extern void PGO_onTypeTraced(char const *module_name, char const *site_name, PyObject *operand1, PyObject *operand2);
+
 #else
 
 #define PGO_Initialize()
@@ -38,6 +42,8 @@ extern void PGO_onTechnicalModule(char const *module_name);
 
 #define PGO_onProbePassed(module_name, probe_id, probe_arg) ;
 
+#define PGO_onTypeTraced(module_name, site_name, operand1, operand2) ;
+
 #endif
 
 #endif
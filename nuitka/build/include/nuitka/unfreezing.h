@@ -4,6 +4,7 @@
 #define __NUITKA_UNFREEZING_H__
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /* Modes for loading modules, can be compiled, external shared library, or
  * bytecode. */
@@ -52,11 +53,49 @@ struct Nuitka_MetaPathBasedLoaderEntry {
 #endif
 };
 
+// Hash of module names, used for the index into the loader entries. This must
+// match "getModuleNameHash" in "LoaderCodes.py" which creates the index at
+// compile time, it is a 32 bit FNV-1a.
+static inline uint32_t Nuitka_HashModuleName(char const *name, size_t length) {
+    uint32_t result = 2166136261U;
+
+    while (length-- > 0) {
+        result ^= (unsigned char)*name++;
+        result *= 16777619U;
+    }
+
+    return result;
+}
+
 /* For embedded modules, register the meta path based loader. Used by main
- * program/package only.
+ * program/package only. The index is an open addressing hash table of the
+ * entry positions, with "-1" for unused slots, and its size a power of two.
+ */
+extern void registerMetaPathBasedLoader(struct Nuitka_MetaPathBasedLoaderEntry *loader_entries, int *loader_index,
+                                        int loader_index_size, unsigned char **bytecode_data);
+
+/* Read the files of extension modules ahead in a background thread, in the
+ * order of the given loader entry indexes, which ends with "-1". This is for
+ * standalone mode only, with the order of a Python PGO run.
+ */
+extern void prefetchExtensionModules(PyThreadState *tstate, int const *prefetch_indexes);
+
+// Data files embedded into the binary, their contents are in the constants
+// blob, next to the bytecode.
+struct Nuitka_EmbeddedDataFileEntry {
+    // Path relative to the binary directory, with native separators.
+    char const *name;
+
+    // Start and size inside the constants blob.
+    int data_index;
+    int data_size;
+};
+
+/* Register the data files embedded into the binary, for the file helpers to
+ * serve them instead of reading files. The list ends with a "NULL" name.
  */
-extern void registerMetaPathBasedLoader(struct Nuitka_MetaPathBasedLoaderEntry *loader_entries,
-                                        unsigned char **bytecode_data);
+extern void registerEmbeddedDataFiles(struct Nuitka_EmbeddedDataFileEntry const *data_file_entries,
+                                      unsigned char **bytecode_data);
 
 // For module mode, embedded modules may have to be shifted to below the
 // namespace they are loaded into.
@@ -23,8 +23,10 @@ int count_released_Nuitka_Cell_Type;
 #endif
 
 #define MAX_CELL_FREE_LIST_COUNT 1000
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_CellObject *free_list_cells = NULL;
 static int free_list_cells_count = 0;
+#endif
 
 static void Nuitka_Cell_tp_dealloc(struct Nuitka_CellObject *cell) {
 #if _DEBUG_REFCOUNTS
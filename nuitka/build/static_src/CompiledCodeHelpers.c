@@ -41,6 +41,7 @@ static void _initBuiltinTypeMethods(void) {
 #include "HelpersExceptions.c"
 #include "HelpersFiles.c"
 #include "HelpersFloats.c"
+#include "HelpersFreeLists.c"
 #include "HelpersHeapStorage.c"
 #include "HelpersImport.c"
 #include "HelpersImportHard.c"
@@ -561,6 +562,56 @@ PyObject *BUILTIN_XRANGE3(PyThreadState *tstate, PyObject *low, PyObject *high,
 #endif
 }
 
+bool MAKE_RANGE_LOOP_ITERATOR(PyThreadState *tstate, nuitka_range_iter *iter, PyObject *range) {
+    CHECK_OBJECT(range);
+
+    if (likely(Py_TYPE(range) == &PyRange_Type)) {
+#if PYTHON_VERSION < 0x300
+        struct _rangeobject2 *range_object = (struct _rangeobject2 *)range;
+
+        iter->iterator = NULL;
+        iter->value = range_object->start;
+        iter->step = range_object->step;
+        iter->remaining = range_object->len;
+
+        return true;
+#else
+        struct _rangeobject3 *range_object = (struct _rangeobject3 *)range;
+
+        // These are all exact "int" values, so no exception can happen here,
+        // only overflows, which are then left to the normal iterator.
+        int overflow_start, overflow_step, overflow_length;
+
+        long start = PyLong_AsLongAndOverflow(range_object->start, &overflow_start);
+        long step = PyLong_AsLongAndOverflow(range_object->step, &overflow_step);
+        long length = PyLong_AsLongAndOverflow(range_object->length, &overflow_length);
+
+        assert(!HAS_ERROR_OCCURRED(tstate));
+
+        if (overflow_start == 0 && overflow_step == 0 && overflow_length == 0) {
+            // The values are between start and stop, so when these fit, all
+            // values fit too.
+            int overflow_stop;
+            PyLong_AsLongAndOverflow(range_object->stop, &overflow_stop);
+
+            if (overflow_stop == 0) {
+                iter->iterator = NULL;
+                iter->value = start;
+                iter->step = step;
+                iter->remaining = length;
+
+                return true;
+            }
+        }
+#endif
+    }
+
+    iter->iterator = MAKE_ITERATOR(tstate, range);
+    iter->remaining = -1;
+
+    return iter->iterator != NULL;
+}
+
 PyObject *BUILTIN_ALL(PyThreadState *tstate, PyObject *value) {
     CHECK_OBJECT(value);
 
@@ -2120,7 +2171,7 @@ PyObject *MAKE_UNION_TYPE(PyObject *args) {
 #include "HelpersChecksumTools.c"
 #include "HelpersConstantsBlob.c"
 
-#if _NUITKA_PROFILE
+#if _NUITKA_PROFILE || _NUITKA_PROFILE_SAMPLING
 #include "HelpersProfiling.c"
 #endif
 
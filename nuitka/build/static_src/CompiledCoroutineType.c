@@ -1006,8 +1006,10 @@ static long Nuitka_Coroutine_tp_traverse(struct Nuitka_CoroutineObject *coroutin
     return 0;
 }
 
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_CoroutineWrapperObject *free_list_coro_wrappers = NULL;
 static int free_list_coro_wrappers_count = 0;
+#endif
 
 static PyObject *Nuitka_Coroutine_await(struct Nuitka_CoroutineObject *coroutine) {
     CHECK_OBJECT(coroutine);
@@ -1085,8 +1087,10 @@ static void Nuitka_Coroutine_tp_finalize(struct Nuitka_CoroutineObject *coroutin
 }
 
 #define MAX_COROUTINE_FREE_LIST_COUNT 100
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_CoroutineObject *free_list_coros = NULL;
 static int free_list_coros_count = 0;
+#endif
 
 static void Nuitka_Coroutine_tp_dealloc(struct Nuitka_CoroutineObject *coroutine) {
 #if _DEBUG_REFCOUNTS
@@ -1688,8 +1692,10 @@ static int Nuitka_AIterWrapper_traverse(struct Nuitka_AIterWrapper *aw, visitpro
     return 0;
 }
 
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_AIterWrapper *free_list_coroutine_aiter_wrappers = NULL;
 static int free_list_coroutine_aiter_wrappers_count = 0;
+#endif
 
 static void Nuitka_AIterWrapper_dealloc(struct Nuitka_AIterWrapper *aw) {
 #if _DEBUG_REFCOUNTS
@@ -187,7 +187,8 @@ static PyObject *_Nuitka_Frame_get_locals(PyObject *self, void *data) {
         while (*w != 0) {
             switch (*w) {
             case NUITKA_TYPE_DESCRIPTION_OBJECT:
-            case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR: {
+            case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR:
+            case NUITKA_TYPE_DESCRIPTION_ILONG: {
                 PyObject *value = *(PyObject **)t;
                 CHECK_OBJECT_X(value);
 
@@ -232,6 +233,17 @@ static PyObject *_Nuitka_Frame_get_locals(PyObject *self, void *data) {
                 }
                 break;
             }
+            case NUITKA_TYPE_DESCRIPTION_FLOAT: {
+                double value;
+                memcpy(&value, t, sizeof(double));
+                t += sizeof(double);
+
+                PyObject *float_value = MAKE_FLOAT_FROM_DOUBLE(value);
+                DICT_SET_ITEM(result, *var_names, float_value);
+                Py_DECREF(float_value);
+
+                break;
+            }
             default:
                 assert(false);
             }
@@ -363,7 +375,8 @@ static void Nuitka_Frame_tp_clear(struct Nuitka_FrameObject *frame) {
         while (*w != 0) {
             switch (*w) {
             case NUITKA_TYPE_DESCRIPTION_OBJECT:
-            case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR: {
+            case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR:
+            case NUITKA_TYPE_DESCRIPTION_ILONG: {
                 PyObject *value = *(PyObject **)t;
                 CHECK_OBJECT_X(value);
 
@@ -392,6 +405,11 @@ static void Nuitka_Frame_tp_clear(struct Nuitka_FrameObject *frame) {
 
                 break;
             }
+            case NUITKA_TYPE_DESCRIPTION_FLOAT: {
+                t += sizeof(double);
+
+                break;
+            }
             default:
                 assert(false);
             }
@@ -404,8 +422,10 @@ static void Nuitka_Frame_tp_clear(struct Nuitka_FrameObject *frame) {
 }
 
 #define MAX_FRAME_FREE_LIST_COUNT 100
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_FrameObject *free_list_frames = NULL;
 static int free_list_frames_count = 0;
+#endif
 
 static void Nuitka_Frame_tp_dealloc(struct Nuitka_FrameObject *nuitka_frame) {
 #if _DEBUG_REFCOUNTS
@@ -499,7 +519,8 @@ static int Nuitka_Frame_tp_traverse(struct Nuitka_FrameObject *frame, visitproc
     while (w != NULL && *w != 0) {
         switch (*w) {
         case NUITKA_TYPE_DESCRIPTION_OBJECT:
-        case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR: {
+        case NUITKA_TYPE_DESCRIPTION_OBJECT_PTR:
+        case NUITKA_TYPE_DESCRIPTION_ILONG: {
             PyObject *value = *(PyObject **)t;
             CHECK_OBJECT_X(value);
 
@@ -527,6 +548,11 @@ static int Nuitka_Frame_tp_traverse(struct Nuitka_FrameObject *frame, visitproc
 
             break;
         }
+        case NUITKA_TYPE_DESCRIPTION_FLOAT: {
+            t += sizeof(double);
+
+            break;
+        }
         default:
             assert(false);
         }
@@ -741,6 +767,7 @@ static struct Nuitka_FrameObject *_MAKE_COMPILED_FRAME(PyCodeObject *code, PyObj
     allocateFromFreeList(free_list_frames, struct Nuitka_FrameObject, Nuitka_Frame_Type, locals_size);
 
     result->m_type_description = NULL;
+    result->m_cache_next = NULL;
 
     PyFrameObject *frame = &result->m_frame;
     // Globals and locals are stored differently before Python 3.11
@@ -1109,6 +1136,36 @@ void Nuitka_Frame_AttachLocals(struct Nuitka_FrameObject *frame_object, char con
 
             break;
         }
+        case NUITKA_TYPE_DESCRIPTION_ILONG: {
+            /* Note: We store the object only, created if necessary, so
+               this is the same as an object for the other uses. */
+            nuitka_ilong value = va_arg(ap, nuitka_ilong);
+            PyObject *object;
+
+            if ((value.validity & NUITKA_ILONG_OBJECT_VALID) == NUITKA_ILONG_OBJECT_VALID) {
+                object = value.ilong_object;
+                CHECK_OBJECT(object);
+
+                Py_INCREF(object);
+            } else if (value.validity == NUITKA_ILONG_VALUE_VALID) {
+                object = Nuitka_PyInt_FromLong(value.ilong_value);
+            } else {
+                object = NULL;
+            }
+
+            memcpy(t, &object, sizeof(PyObject *));
+            t += sizeof(PyObject *);
+
+            break;
+        }
+        case NUITKA_TYPE_DESCRIPTION_FLOAT: {
+            double value = va_arg(ap, double);
+            memcpy(t, &value, sizeof(double));
+
+            t += sizeof(value);
+
+            break;
+        }
         default:
             assert(false);
         }
@@ -732,8 +732,10 @@ static PyObject *Nuitka_Function_clone(struct Nuitka_FunctionObject *function) {
 }
 
 #define MAX_FUNCTION_FREE_LIST_COUNT 100
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_FunctionObject *free_list_functions = NULL;
 static int free_list_functions_count = 0;
+#endif
 
 static void Nuitka_Function_tp_dealloc(struct Nuitka_FunctionObject *function) {
 #if _DEBUG_REFCOUNTS
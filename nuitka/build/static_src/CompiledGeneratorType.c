@@ -1368,8 +1368,10 @@ static void Nuitka_Generator_tp_finalizer(struct Nuitka_GeneratorObject *generat
 #endif
 
 #define MAX_GENERATOR_FREE_LIST_COUNT 100
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_GeneratorObject *free_list_generators = NULL;
 static int free_list_generators_count = 0;
+#endif
 
 static void Nuitka_Generator_tp_dealloc(struct Nuitka_GeneratorObject *generator) {
 #if _DEBUG_REFCOUNTS
@@ -408,8 +408,10 @@ static long Nuitka_Method_tp_hash(struct Nuitka_MethodObject *method) {
 }
 
 #define MAX_METHOD_FREE_LIST_COUNT 100
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_MethodObject *free_list_methods = NULL;
 static int free_list_methods_count = 0;
+#endif
 
 static void Nuitka_Method_tp_dealloc(struct Nuitka_MethodObject *method) {
 #ifndef __NUITKA_NO_ASSERT__
@@ -1059,6 +1059,295 @@ bool SET_ATTRIBUTE(PyThreadState *tstate, PyObject *target, PyObject *attr_name,
 #endif
 }
 
+#if NUITKA_ATTRIBUTE_CACHE
+static inline bool _hasValidTypeVersionTag(PyTypeObject *type) {
+    return PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) && type->tp_version_tag != 0;
+}
+
+static void _setAttributeCache(PyTypeObject *type, struct Nuitka_AttributeCache *cache,
+                               enum Nuitka_AttributeCacheKind kind, PyObject *descr, Py_ssize_t index) {
+    cache->type = type;
+    cache->type_version_tag = type->tp_version_tag;
+    cache->kind = kind;
+    cache->descr = descr;
+    cache->index = index;
+}
+
+// Fill the cache for the type, false if that is not possible. Types the cache
+// cannot handle get an entry too, to avoid repeating the lookup done here.
+static bool _fillAttributeCache(PyTypeObject *type, PyObject *attr_name, struct Nuitka_AttributeCache *cache,
+                                bool is_store) {
+    cache->kind = ATTRIBUTE_CACHE_EMPTY;
+
+    // Only the standard attribute handling is known to us. Changing it for a
+    // type changes its version tag.
+    if (is_store ? type->tp_setattro != PyObject_GenericSetAttr_resolved
+                 : type->tp_getattro != PyObject_GenericGetAttr_resolved) {
+        if (!_hasValidTypeVersionTag(type)) {
+            return false;
+        }
+
+        _setAttributeCache(type, cache, ATTRIBUTE_CACHE_UNCACHEABLE, NULL, -1);
+        return true;
+    }
+
+    if (unlikely(type->tp_dict == NULL)) {
+        return false;
+    }
+
+    // This also assigns the version tag to the type, if it has none yet.
+    PyObject *descr = Nuitka_TypeLookup(type, attr_name);
+
+    if (!_hasValidTypeVersionTag(type)) {
+        return false;
+    }
+
+    enum Nuitka_AttributeCacheKind kind;
+    Py_ssize_t index = -1;
+
+    if (descr != NULL && Nuitka_Descr_IsData(descr)) {
+        // Data descriptors take precedence over the instance dictionary.
+        PyTypeObject *descr_type = Py_TYPE(descr);
+
+        PyMemberDef *member = descr_type == &PyMemberDescr_Type ? ((PyMemberDescrObject *)descr)->d_member : NULL;
+
+        // Only plain object members, as used for "__slots__", writable for stores.
+        if (member != NULL && member->type == T_OBJECT_EX &&
+            (member->flags & ~(is_store ? 0 : READONLY)) == 0 && PyType_IsSubtype(type, PyDescr_TYPE(descr))) {
+            kind = ATTRIBUTE_CACHE_MEMBER;
+            index = member->offset;
+        } else if (is_store || descr_type->tp_descr_get != NULL) {
+            kind = ATTRIBUTE_CACHE_DATA_DESCRIPTOR;
+        } else {
+            kind = ATTRIBUTE_CACHE_UNCACHEABLE;
+        }
+    } else {
+#if PYTHON_VERSION >= 0x3c0
+        if (type->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+            kind = ATTRIBUTE_CACHE_UNCACHEABLE;
+        } else
+#endif
+        {
+            kind = ATTRIBUTE_CACHE_INSTANCE;
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+            if (type->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+                index = Nuitka_GetSharedKeysIndex(type, attr_name);
+            }
+#endif
+        }
+    }
+
+    if (kind == ATTRIBUTE_CACHE_UNCACHEABLE) {
+        descr = NULL;
+    }
+
+    _setAttributeCache(type, cache, kind, descr, index);
+
+    return true;
+}
+
+static inline bool _checkAttributeCache(PyTypeObject *type, struct Nuitka_AttributeCache const *cache) {
+    return type == cache->type && type->tp_version_tag == cache->type_version_tag &&
+           cache->kind != ATTRIBUTE_CACHE_EMPTY && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG);
+}
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+// Instance values slot of the attribute, NULL if the object has a materialized
+// dictionary instead, or the name is not in the shared keys of the type.
+static PyObject **_getAttributeCacheValuesSlot(PyTypeObject *type, PyObject *source, PyObject *attr_name,
+                                               struct Nuitka_AttributeCache *cache) {
+    if ((type->tp_flags & Py_TPFLAGS_MANAGED_DICT) == 0 || *_PyObject_ManagedDictPointer(source) != NULL) {
+        return NULL;
+    }
+
+    PyDictValues *values = *_PyObject_ValuesPointer(source);
+
+    if (unlikely(values == NULL)) {
+        return NULL;
+    }
+
+    // The shared keys only grow, so once found, the index remains valid.
+    if (cache->index < 0) {
+        cache->index = Nuitka_GetSharedKeysIndex(type, attr_name);
+
+        if (cache->index < 0) {
+            return NULL;
+        }
+    }
+
+    return &values->values[cache->index];
+}
+#endif
+
+#endif
+
+PyObject *LOOKUP_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                  struct Nuitka_AttributeCache *cache) {
+    CHECK_OBJECT(source);
+    CHECK_OBJECT(attr_name);
+
+#if NUITKA_ATTRIBUTE_CACHE
+    PyTypeObject *type = Py_TYPE(source);
+
+    if (likely(_checkAttributeCache(type, cache) || _fillAttributeCache(type, attr_name, cache, false))) {
+        PyObject *descr = cache->descr;
+
+        switch (cache->kind) {
+        case ATTRIBUTE_CACHE_MEMBER: {
+            PyObject *result = *(PyObject **)((char *)source + cache->index);
+
+            // Unassigned slots raise through the uncached path.
+            if (likely(result != NULL)) {
+                Py_INCREF(result);
+                return result;
+            }
+
+            break;
+        }
+        case ATTRIBUTE_CACHE_DATA_DESCRIPTOR: {
+            Py_INCREF(descr);
+            PyObject *result = Py_TYPE(descr)->tp_descr_get(descr, source, (PyObject *)type);
+            Py_DECREF(descr);
+
+            CHECK_OBJECT_X(result);
+            return result;
+        }
+        case ATTRIBUTE_CACHE_INSTANCE: {
+            PyObject *result;
+
+            // The dictionary lookup may run code, that changes the type and
+            // releases the descriptor the cache refers to.
+            Py_XINCREF(descr);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+            PyObject **values_slot = _getAttributeCacheValuesSlot(type, source, attr_name, cache);
+
+            if (values_slot != NULL) {
+                result = *values_slot;
+                Py_XINCREF(result);
+            } else if (unlikely(Nuitka_LookupInstanceDictAttribute(tstate, type, source, attr_name, &result) ==
+                                false)) {
+                Py_XDECREF(descr);
+                break;
+            }
+#else
+            if (unlikely(Nuitka_LookupInstanceDictAttribute(tstate, type, source, attr_name, &result) == false)) {
+                Py_XDECREF(descr);
+                break;
+            }
+#endif
+
+            if (result != NULL) {
+                CHECK_OBJECT(result);
+
+                Py_XDECREF(descr);
+                return result;
+            }
+
+            // Missing attributes raise through the uncached path.
+            if (descr == NULL) {
+                break;
+            }
+
+            descrgetfunc func = Py_TYPE(descr)->tp_descr_get;
+
+            if (func != NULL) {
+                result = func(descr, source, (PyObject *)type);
+                Py_DECREF(descr);
+
+                CHECK_OBJECT_X(result);
+                return result;
+            }
+
+            return descr;
+        }
+        case ATTRIBUTE_CACHE_UNCACHEABLE:
+            break;
+        default:
+            NUITKA_CANNOT_GET_HERE("unexpected attribute cache kind");
+        }
+    }
+#endif
+
+    return LOOKUP_ATTRIBUTE(tstate, source, attr_name);
+}
+
+bool SET_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *target, PyObject *attr_name, PyObject *value,
+                          struct Nuitka_AttributeCache *cache) {
+    CHECK_OBJECT(target);
+    CHECK_OBJECT(attr_name);
+    CHECK_OBJECT(value);
+
+#if NUITKA_ATTRIBUTE_CACHE
+    PyTypeObject *type = Py_TYPE(target);
+
+    if (likely(_checkAttributeCache(type, cache) || _fillAttributeCache(type, attr_name, cache, true))) {
+        switch (cache->kind) {
+        case ATTRIBUTE_CACHE_MEMBER: {
+            PyObject **slot = (PyObject **)((char *)target + cache->index);
+            PyObject *old = *slot;
+
+            Py_INCREF(value);
+            *slot = value;
+            Py_XDECREF(old);
+
+            return true;
+        }
+        case ATTRIBUTE_CACHE_DATA_DESCRIPTOR: {
+            PyObject *descr = cache->descr;
+
+            Py_INCREF(descr);
+            int res = Py_TYPE(descr)->tp_descr_set(descr, target, value);
+            Py_DECREF(descr);
+
+            return res == 0;
+        }
+        case ATTRIBUTE_CACHE_INSTANCE: {
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+            PyObject **values_slot = _getAttributeCacheValuesSlot(type, target, attr_name, cache);
+
+            if (values_slot != NULL) {
+                PyObject *old = *values_slot;
+
+                Py_INCREF(value);
+                *values_slot = value;
+
+                if (old == NULL) {
+                    _PyDictValues_AddToInsertionOrder(*_PyObject_ValuesPointer(target), cache->index);
+                } else {
+                    Py_DECREF(old);
+                }
+
+                return true;
+            }
+#endif
+            PyObject **dict_pointer = Nuitka_GetInstanceDictPointer(type, target);
+            PyObject *dict = dict_pointer != NULL ? *dict_pointer : NULL;
+
+            // Split tables and creating the dictionary is left to the uncached
+            // path, which also maintains the shared keys of the type.
+            if (dict != NULL && PyDict_CheckExact(dict) && ((PyDictObject *)dict)->ma_values == NULL) {
+                Py_INCREF(dict);
+                bool res = DICT_SET_ITEM(dict, attr_name, value);
+                Py_DECREF(dict);
+
+                return res;
+            }
+
+            break;
+        }
+        case ATTRIBUTE_CACHE_UNCACHEABLE:
+            break;
+        default:
+            NUITKA_CANNOT_GET_HERE("unexpected attribute cache kind");
+        }
+    }
+#endif
+
+    return SET_ATTRIBUTE(tstate, target, attr_name, value);
+}
+
 bool SET_ATTRIBUTE_DICT_SLOT(PyThreadState *tstate, PyObject *target, PyObject *value) {
     CHECK_OBJECT(target);
     CHECK_OBJECT(value);
@@ -1232,6 +1521,59 @@ PyObject *GET_MODULE_VARIABLE_VALUE_FALLBACK(PyThreadState *tstate, PyObject *va
     return result;
 }
 
+#if NUITKA_MODULE_VALUE_CACHE
+static PyObject *_LOOKUP_CACHED_DICT_VALUE(PyDictObject *dict, PyObject *var_name, PyObject ***value_slot) {
+    Nuitka_DictEntryHandle handle = GET_STRING_DICT_ENTRY(dict, (Nuitka_StringObject *)var_name);
+
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    *value_slot = handle;
+    return GET_DICT_ENTRY_VALUE(handle);
+}
+#endif
+
+PyObject *LOOKUP_MODULE_VALUE_CACHE_FALLBACK(PyDictObject *module_dict, PyObject *var_name,
+                                             struct Nuitka_ModuleValueCache *cache) {
+#if NUITKA_MODULE_VALUE_CACHE
+    PyObject **value_slot;
+
+    PyObject *result = _LOOKUP_CACHED_DICT_VALUE(module_dict, var_name, &value_slot);
+
+    if (likely(result != NULL)) {
+        cache->value_slot = value_slot;
+        cache->module_dict_version = module_dict->ma_version_tag;
+        cache->builtins_dict_version = 0;
+
+        return result;
+    }
+
+    result = _LOOKUP_CACHED_DICT_VALUE(dict_builtin, var_name, &value_slot);
+
+    if (likely(result != NULL)) {
+        cache->value_slot = value_slot;
+        cache->module_dict_version = module_dict->ma_version_tag;
+        cache->builtins_dict_version = dict_builtin->ma_version_tag;
+    }
+
+    return result;
+#else
+    return LOOKUP_MODULE_VALUE(module_dict, var_name);
+#endif
+}
+
+PyObject *GET_MODULE_VARIABLE_VALUE_CACHE_FALLBACK(PyThreadState *tstate, PyDictObject *module_dict,
+                                                   PyObject *variable_name, struct Nuitka_ModuleValueCache *cache) {
+    PyObject *result = LOOKUP_MODULE_VALUE_CACHE_FALLBACK(module_dict, variable_name, cache);
+
+    if (unlikely(result == NULL)) {
+        SET_CURRENT_EXCEPTION_NAME_ERROR(tstate, variable_name);
+    }
+
+    return result;
+}
+
 #if PYTHON_VERSION < 0x340
 PyObject *GET_MODULE_VARIABLE_VALUE_FALLBACK_IN_FUNCTION(PyThreadState *tstate, PyObject *variable_name) {
     PyObject *result = GET_STRING_DICT_VALUE(dict_builtin, (Nuitka_StringObject *)variable_name);
@@ -221,6 +221,10 @@ PyObject *BUILTIN_OPEN(PyThreadState *tstate, PyObject *file_name, PyObject *mod
         return result;
     }
 
+    if (OPEN_EMBEDDED_DATA_FILE(tstate, file_name, mode, NULL, NULL, NULL, &result)) {
+        return result;
+    }
+
     PyObject *args[] = {file_name, mode, buffering};
 
     char const *arg_names[] = {"name", "mode", "buffering"};
@@ -238,6 +242,10 @@ PyObject *BUILTIN_OPEN(PyThreadState *tstate, PyObject *file_name, PyObject *mod
         return result;
     }
 
+    if (OPEN_EMBEDDED_DATA_FILE(tstate, file_name, mode, encoding, errors, newline, &result)) {
+        return result;
+    }
+
     PyObject *args[] = {file_name, mode, buffering, encoding, errors, newline, closefd, opener};
 
     char const *arg_names[] = {"file", "mode", "buffering", "encoding", "errors", "newline", "closefd", "opener"};
@@ -513,7 +513,9 @@ static PyObject *list_builtin_insert = NULL;
 static PyObject *list_builtin_pop = NULL;
 static PyObject *list_builtin_remove = NULL;
 static PyObject *list_builtin_reverse = NULL;
+#if PYTHON_VERSION >= 0x300
 static PyObject *list_builtin_sort = NULL;
+#endif
 static void _initListBuiltinMethods(void) {
     list_builtin_append = PyObject_GetAttrString((PyObject *)&PyList_Type, "append");
 #if PYTHON_VERSION >= 0x300
@@ -529,7 +531,9 @@ static void _initListBuiltinMethods(void) {
     list_builtin_pop = PyObject_GetAttrString((PyObject *)&PyList_Type, "pop");
     list_builtin_remove = PyObject_GetAttrString((PyObject *)&PyList_Type, "remove");
     list_builtin_reverse = PyObject_GetAttrString((PyObject *)&PyList_Type, "reverse");
+#if PYTHON_VERSION >= 0x300
     list_builtin_sort = PyObject_GetAttrString((PyObject *)&PyList_Type, "sort");
+#endif
 }
 PyObject *DICT_POP2(PyThreadState *tstate, PyObject *dict, PyObject *key) {
     CHECK_OBJECT(dict);
@@ -381,6 +381,211 @@ void formatCannotInstantiateAbstractClass(PyThreadState *tstate, PyTypeObject *t
 
 #include "HelpersCallingGenerated.c"
 
+#if NUITKA_METHOD_CALL_CACHE
+
+static bool _fillMethodCallCache(PyTypeObject *type, PyObject *attr_name, struct Nuitka_MethodCallCache *cache) {
+    cache->kind = METHOD_CALL_CACHE_EMPTY;
+
+    // Only the standard attribute lookup is known to find the type attribute
+    // after the instance dictionary.
+    if (type->tp_getattro != PyObject_GenericGetAttr_resolved || unlikely(type->tp_dict == NULL)) {
+        return false;
+    }
+
+#if PYTHON_VERSION >= 0x3c0
+    if (type->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+        return false;
+    }
+#endif
+
+    // This also assigns the version tag to the type, if it has none yet.
+    PyObject *descr = Nuitka_TypeLookup(type, attr_name);
+
+    if (descr == NULL || !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) || type->tp_version_tag == 0) {
+        return false;
+    }
+
+    PyTypeObject *descr_type = Py_TYPE(descr);
+    enum Nuitka_MethodCallCacheKind kind;
+
+    if (descr_type == &Nuitka_Function_Type) {
+        kind = METHOD_CALL_CACHE_COMPILED_FUNCTION;
+    } else if (descr_type == &PyMethodDescr_Type || descr_type == &PyFunction_Type) {
+        kind = METHOD_CALL_CACHE_UNBOUND;
+    } else if (descr_type == &PyCFunction_Type) {
+        kind = METHOD_CALL_CACHE_CFUNCTION;
+    } else {
+        return false;
+    }
+
+    cache->type = type;
+    cache->type_version_tag = type->tp_version_tag;
+    cache->kind = kind;
+    cache->descr = descr;
+
+    return true;
+}
+
+// Returns the cached attribute of the type to call, or NULL if the uncached
+// path has to be used.
+static PyObject *_lookupMethodCallCache(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                        struct Nuitka_MethodCallCache *cache) {
+    CHECK_OBJECT(source);
+    CHECK_OBJECT(attr_name);
+
+    PyTypeObject *type = Py_TYPE(source);
+
+    if (unlikely(type != cache->type || type->tp_version_tag != cache->type_version_tag ||
+                 cache->kind == METHOD_CALL_CACHE_EMPTY ||
+                 !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))) {
+        if (_fillMethodCallCache(type, attr_name, cache) == false) {
+            return NULL;
+        }
+    }
+
+    // The instance dictionary takes precedence over the non-data descriptors
+    // we cache, and for unknown values, the uncached path is taken.
+    PyObject *instance_value;
+
+    if (unlikely(Nuitka_LookupInstanceDictAttribute(tstate, type, source, attr_name, &instance_value) == false ||
+                 instance_value != NULL)) {
+        return NULL;
+    }
+
+    CHECK_OBJECT(cache->descr);
+    return cache->descr;
+}
+
+static PyObject *_callMethodCacheVectorcall(PyThreadState *tstate, PyObject *called, PyObject *const *args,
+                                            Py_ssize_t args_count) {
+    vectorcallfunc func = *((vectorcallfunc *)(((char *)called) + Py_TYPE(called)->tp_vectorcall_offset));
+
+    PyObject *result;
+
+    if (likely(func != NULL)) {
+        result = func(called, args, args_count, NULL);
+    } else {
+        PyObject *pos_args = MAKE_TUPLE(tstate, args, args_count);
+        result = CALL_FUNCTION(tstate, called, pos_args, NULL);
+        Py_DECREF(pos_args);
+    }
+
+#ifndef __NUITKA_NO_ASSERT__
+    return Nuitka_CheckFunctionResult(tstate, called, result);
+#else
+    return result;
+#endif
+}
+
+static PyObject *_callMethodCacheDescr(PyThreadState *tstate, struct Nuitka_MethodCallCache const *cache,
+                                       PyObject *descr, PyObject *source, PyObject *const *args,
+                                       Py_ssize_t args_count) {
+    // The cache holds no reference, but the call may remove the attribute
+    // from the type.
+    Py_INCREF(descr);
+
+    PyObject *result;
+
+    switch (cache->kind) {
+    case METHOD_CALL_CACHE_COMPILED_FUNCTION:
+        if (args_count == 0) {
+            result = Nuitka_CallMethodFunctionNoArgs(tstate, (struct Nuitka_FunctionObject const *)descr, source);
+        } else {
+            result = Nuitka_CallMethodFunctionPosArgs(tstate, (struct Nuitka_FunctionObject const *)descr, source,
+                                                      args, args_count);
+        }
+        break;
+    case METHOD_CALL_CACHE_UNBOUND: {
+        PyObject *call_args[11];
+        assert(args_count < 11);
+
+        call_args[0] = source;
+        memcpy(&call_args[1], args, sizeof(PyObject *) * args_count);
+
+        result = _callMethodCacheVectorcall(tstate, descr, call_args, args_count + 1);
+        break;
+    }
+    case METHOD_CALL_CACHE_CFUNCTION:
+        result = _callMethodCacheVectorcall(tstate, descr, args, args_count);
+        break;
+    default:
+        NUITKA_CANNOT_GET_HERE("unexpected method call cache kind");
+        result = NULL;
+    }
+
+    Py_DECREF(descr);
+
+    return result;
+}
+
+#endif
+
+PyObject *CALL_METHOD_NO_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                     struct Nuitka_MethodCallCache *cache) {
+#if NUITKA_METHOD_CALL_CACHE
+    PyObject *descr = _lookupMethodCallCache(tstate, source, attr_name, cache);
+
+    if (likely(descr != NULL)) {
+        return _callMethodCacheDescr(tstate, cache, descr, source, NULL, 0);
+    }
+#endif
+
+    return CALL_METHOD_NO_ARGS(tstate, source, attr_name);
+}
+
+PyObject *CALL_METHOD_WITH_SINGLE_ARG_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                             PyObject *arg, struct Nuitka_MethodCallCache *cache) {
+#if NUITKA_METHOD_CALL_CACHE
+    PyObject *descr = _lookupMethodCallCache(tstate, source, attr_name, cache);
+
+    if (likely(descr != NULL)) {
+        return _callMethodCacheDescr(tstate, cache, descr, source, &arg, 1);
+    }
+#endif
+
+    return CALL_METHOD_WITH_SINGLE_ARG(tstate, source, attr_name, arg);
+}
+
+PyObject *CALL_METHOD_WITH_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                       PyObject *const *args, Py_ssize_t args_count,
+                                       struct Nuitka_MethodCallCache *cache) {
+    CHECK_OBJECTS(args, args_count);
+
+#if NUITKA_METHOD_CALL_CACHE
+    PyObject *descr = _lookupMethodCallCache(tstate, source, attr_name, cache);
+
+    if (likely(descr != NULL)) {
+        return _callMethodCacheDescr(tstate, cache, descr, source, args, args_count);
+    }
+#endif
+
+    switch (args_count) {
+    case 1:
+        return CALL_METHOD_WITH_SINGLE_ARG(tstate, source, attr_name, args[0]);
+    case 2:
+        return CALL_METHOD_WITH_ARGS2(tstate, source, attr_name, args);
+    case 3:
+        return CALL_METHOD_WITH_ARGS3(tstate, source, attr_name, args);
+    case 4:
+        return CALL_METHOD_WITH_ARGS4(tstate, source, attr_name, args);
+    case 5:
+        return CALL_METHOD_WITH_ARGS5(tstate, source, attr_name, args);
+    case 6:
+        return CALL_METHOD_WITH_ARGS6(tstate, source, attr_name, args);
+    case 7:
+        return CALL_METHOD_WITH_ARGS7(tstate, source, attr_name, args);
+    case 8:
+        return CALL_METHOD_WITH_ARGS8(tstate, source, attr_name, args);
+    case 9:
+        return CALL_METHOD_WITH_ARGS9(tstate, source, attr_name, args);
+    case 10:
+        return CALL_METHOD_WITH_ARGS10(tstate, source, attr_name, args);
+    default:
+        NUITKA_CANNOT_GET_HERE("unsupported argument count for cached method call");
+        return NULL;
+    }
+}
+
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
 //     integrates with CPython, but also works on its own.
 //
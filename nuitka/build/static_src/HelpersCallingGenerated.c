@@ -236,6 +236,13 @@ PyObject *CALL_FUNCTION_NO_ARGS(PyThreadState *tstate, PyObject *called) {
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -669,6 +676,13 @@ PyObject *CALL_FUNCTION_WITH_SINGLE_ARG(PyThreadState *tstate, PyObject *called,
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 1);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -1109,6 +1123,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS1(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -1527,6 +1548,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS2(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 2);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -1948,6 +1976,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS2(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -2365,6 +2400,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS3(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 3);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -2786,6 +2828,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS3(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -3203,6 +3252,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS4(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 4);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -3624,6 +3680,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS4(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -4041,6 +4104,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS5(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 5);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -4462,6 +4532,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS5(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -4879,6 +4956,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS6(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 6);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -5300,6 +5384,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS6(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -5717,6 +5808,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS7(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 7);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -6138,6 +6236,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS7(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -6555,6 +6660,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS8(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 8);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -6976,6 +7088,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS8(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -7393,6 +7512,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS9(PyThreadState *tstate, PyObject *called, PyOb
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 9);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -7814,6 +7940,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS9(PyThreadState *tstate, PyObject *called, P
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
@@ -8231,6 +8364,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS10(PyThreadState *tstate, PyObject *called, PyO
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 pos_args = MAKE_TUPLE(tstate, args, 10);
                 obj = called_type->tp_new(called_type, pos_args, NULL);
@@ -8652,6 +8792,13 @@ PyObject *CALL_FUNCTION_WITH_POSARGS10(PyThreadState *tstate, PyObject *called,
 
                 obj = called_type->tp_alloc(called_type, 0);
                 CHECK_OBJECT(obj);
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+                if (unlikely(Nuitka_InitInstanceValues(obj) == false)) {
+                    Py_DECREF(obj);
+                    obj = NULL;
+                }
+#endif
             } else {
                 obj = called_type->tp_new(called_type, pos_args, NULL);
             }
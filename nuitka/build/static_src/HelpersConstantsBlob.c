@@ -487,6 +487,42 @@ PyObject *_unpackSpecialValue(unsigned char special_index) {
 static unsigned char const *_unpackBlobConstants(PyThreadState *tstate, PyObject **output, unsigned char const *data,
                                                  int count);
 
+#if PYTHON_VERSION >= 0x300
+// Create an ASCII str object, that uses the zero terminated blob data for its
+// value without copying it. Only the object header is allocated, and it is not
+// a compact object, therefore it must not ever be released.
+static PyObject *Nuitka_Unicode_FromBlobASCII(unsigned char const *data, Py_ssize_t size) {
+    assert(data[size] == 0);
+
+    PyUnicodeObject *result = (PyUnicodeObject *)PyObject_Malloc(sizeof(PyUnicodeObject));
+    assert(result != NULL);
+
+    memset(result, 0, sizeof(PyUnicodeObject));
+    PyObject_Init((PyObject *)result, &PyUnicode_Type);
+
+    PyASCIIObject *ascii = (PyASCIIObject *)result;
+    ascii->length = size;
+    ascii->hash = -1;
+    ascii->state.kind = PyUnicode_1BYTE_KIND;
+    ascii->state.compact = 0;
+    ascii->state.ascii = 1;
+#if PYTHON_VERSION < 0x3c0
+    ascii->state.ready = 1;
+#endif
+
+    // For ASCII, the UTF8 value is shared with the data.
+    ((PyCompactUnicodeObject *)result)->utf8 = (char *)data;
+    ((PyCompactUnicodeObject *)result)->utf8_length = size;
+
+    result->data.any = (void *)data;
+
+    return (PyObject *)result;
+}
+#endif
+
+// Where to record the data of lazy constants, while loading a module blob.
+static unsigned char const **lazy_constants_output = NULL;
+
 static unsigned char const *_unpackBlobConstant(PyThreadState *tstate, PyObject **output, unsigned char const *data) {
 
     // Make sure we discover failures to assign.
@@ -843,6 +879,19 @@ static unsigned char const *_unpackBlobConstant(PyThreadState *tstate, PyObject
 
         break;
     }
+#if PYTHON_VERSION >= 0x300
+    case 's': { // Python3 str, ASCII only, length indicated, and zero terminated.
+        Py_ssize_t size = (Py_ssize_t)_unpackVariableLength(&data);
+
+        PyObject *u = Nuitka_Unicode_FromBlobASCII(data, size);
+        data += size + 1;
+
+        *output = u;
+        is_object = true;
+
+        break;
+    }
+#endif
     case 'v': {
         int size = (int)_unpackVariableLength(&data);
 
@@ -1050,6 +1099,23 @@ static unsigned char const *_unpackBlobConstant(PyThreadState *tstate, PyObject
 
         break;
     }
+    case 'y': {
+        // Lazy constant, only record where its data is, and leave it to the
+        // using function code to unpack it with "loadLazyConstant" when it
+        // first runs.
+        uint64_t size = _unpackVariableLength(&data);
+
+        if (unlikely(lazy_constants_output == NULL)) {
+            NUITKA_CANNOT_GET_HERE("Unexpected lazy constant in constants blob");
+        }
+
+        *lazy_constants_output++ = data;
+        is_object = false;
+
+        data += size;
+
+        break;
+    }
     case 'X': {
         // Blob data pointer, user knowns size.
         uint64_t size = _unpackVariableLength(&data);
@@ -1220,7 +1286,17 @@ unsigned char *findMacOSBinarySection(void) {
 
 #endif
 
-void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *name) {
+void loadLazyConstant(PyThreadState *tstate, PyObject **output, unsigned char const *data) {
+    assert(*output == NULL);
+
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_CONSTANTS
+    printf("Loading lazy constant at offset %d\n", (int)(data - constant_bin));
+#endif
+
+    _unpackBlobConstant(tstate, output, data);
+}
+
+void loadConstantsBlob(PyThreadState *tstate, PyObject **output, unsigned char const **lazy_output, char const *name) {
     static bool init_done = false;
 
     if (init_done == false) {
@@ -1305,7 +1381,9 @@ void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *nam
         w += size;
     }
 
+    lazy_constants_output = lazy_output;
     unpackBlobConstants(tstate, output, w);
+    lazy_constants_output = NULL;
 }
 
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
@@ -1449,6 +1449,179 @@ PyObject *MAKE_DICT_X_CSTR(char const **keys, PyObject **values, Py_ssize_t size
     return result;
 }
 
+#if PYTHON_VERSION >= 0x380
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+// Index of an attribute name in the shared keys of a type, which are used by
+// the instance values of managed dictionaries, negative if not present.
+NUITKA_MAY_BE_UNUSED static Py_ssize_t Nuitka_GetSharedKeysIndex(PyTypeObject *type, PyObject *attr_name) {
+    assert(type->tp_flags & Py_TPFLAGS_MANAGED_DICT);
+    assert(PyUnicode_CheckExact(attr_name));
+
+    PyDictKeysObject *keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
+
+    if (keys == NULL) {
+        return DKIX_EMPTY;
+    }
+
+    Py_hash_t hash = Nuitka_Py_unicode_get_hash(attr_name);
+
+    if (unlikely(hash == -1)) {
+        hash = PyUnicode_Type.tp_hash(attr_name);
+    }
+
+    return Nuitka_Py_unicodekeys_lookup_unicode(keys, attr_name, hash);
+}
+
+// Create the instance values of a new object with a managed dictionary, what
+// "object.__new__" does, since otherwise the first attribute assignment will
+// materialize a dictionary. CPython does it in "_PyObject_InitializeDict", but
+// that is not exported, so this follows its "init_inline_values" of 3.11 only.
+NUITKA_MAY_BE_UNUSED static bool Nuitka_InitInstanceValues(PyObject *obj) {
+    PyTypeObject *type = Py_TYPE(obj);
+
+    if ((type->tp_flags & Py_TPFLAGS_MANAGED_DICT) == 0) {
+        return true;
+    }
+
+    assert(type->tp_flags & Py_TPFLAGS_HEAPTYPE);
+
+    PyDictKeysObject *keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
+
+    if (unlikely(keys == NULL)) {
+        return true;
+    }
+
+    assert(keys->dk_kind == DICT_KEYS_SPLIT);
+
+    // Every object with values reserves one usable key, this makes the shared
+    // keys stop growing eventually.
+    if (keys->dk_usable > 1) {
+        keys->dk_usable--;
+    }
+
+    Py_ssize_t size = keys->dk_nentries + keys->dk_usable;
+    assert(size > 0);
+
+    // Same layout as CPython uses, the insertion order is a prefix before the
+    // values, with its size and used count stored just before them.
+    size_t prefix_size = _Py_SIZE_ROUND_UP(size + 2, sizeof(PyObject *));
+    assert(prefix_size < 256);
+    assert(prefix_size % sizeof(PyObject *) == 0);
+
+    uint8_t *mem = (uint8_t *)PyMem_Malloc(prefix_size + size * sizeof(PyObject *));
+
+    if (unlikely(mem == NULL)) {
+        PyErr_NoMemory();
+        return false;
+    }
+
+    mem[prefix_size - 1] = (uint8_t)prefix_size;
+    mem[prefix_size - 2] = 0;
+
+    PyDictValues *values = (PyDictValues *)(mem + prefix_size);
+    assert(((uint8_t *)values)[-1] >= size + 2);
+
+    for (Py_ssize_t i = 0; i < size; i++) {
+        values->values[i] = NULL;
+    }
+
+    *_PyObject_ValuesPointer(obj) = values;
+
+    return true;
+}
+#endif
+
+// Pointer to the instance dictionary of an object, for managed dictionaries
+// of 3.11 that is only the materialized one, NULL if there is no slot.
+NUITKA_MAY_BE_UNUSED static PyObject **Nuitka_GetInstanceDictPointer(PyTypeObject *type, PyObject *source) {
+#if PYTHON_VERSION >= 0x3b0
+    if (type->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+#if PYTHON_VERSION < 0x3c0
+        return _PyObject_ManagedDictPointer(source);
+#else
+        // TODO: The managed dictionary layout changed with 3.12 and again
+        // with 3.13, callers must not get here for these.
+        NUITKA_CANNOT_GET_HERE("no managed dictionary support");
+        return NULL;
+#endif
+    }
+#endif
+
+    Py_ssize_t dict_offset = type->tp_dictoffset;
+
+    if (dict_offset == 0) {
+        return NULL;
+    }
+
+    // Negative dictionary offsets have special meaning.
+    if (dict_offset < 0) {
+        Py_ssize_t tsize = ((PyVarObject *)source)->ob_size;
+        if (tsize < 0) {
+            tsize = -tsize;
+        }
+        size_t size = _PyObject_VAR_SIZE(type, tsize);
+
+        dict_offset += (long)size;
+    }
+
+    return (PyObject **)((char *)source + dict_offset);
+}
+
+// Lookup an attribute in the instance dictionary of an object with generic
+// attribute handling. Returns false if that cannot be told, for managed
+// dictionaries of 3.12 or later, otherwise "value" is set to the found value
+// as a new reference, or NULL if not present.
+NUITKA_MAY_BE_UNUSED static bool Nuitka_LookupInstanceDictAttribute(PyThreadState *tstate, PyTypeObject *type,
+                                                                     PyObject *source, PyObject *attr_name,
+                                                                     PyObject **value) {
+#if PYTHON_VERSION >= 0x3c0
+    if (type->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+        return false;
+    }
+#endif
+
+    *value = NULL;
+
+    PyObject **dict_pointer = Nuitka_GetInstanceDictPointer(type, source);
+
+    if (dict_pointer == NULL) {
+        return true;
+    }
+
+    PyObject *dict = *dict_pointer;
+
+#if PYTHON_VERSION >= 0x3b0 && PYTHON_VERSION < 0x3c0
+    if (dict == NULL && (type->tp_flags & Py_TPFLAGS_MANAGED_DICT)) {
+        PyDictValues *values = *_PyObject_ValuesPointer(source);
+
+        if (values != NULL) {
+            Py_ssize_t ix = Nuitka_GetSharedKeysIndex(type, attr_name);
+
+            if (ix >= 0) {
+                *value = values->values[ix];
+                Py_XINCREF(*value);
+            }
+        }
+
+        return true;
+    }
+#endif
+
+    if (dict != NULL) {
+        CHECK_OBJECT(dict);
+
+        // The lookup may run code that releases the dictionary and the value.
+        Py_INCREF(dict);
+        *value = DICT_GET_ITEM1(tstate, dict, attr_name);
+        Py_DECREF(dict);
+    }
+
+    return true;
+}
+
+#endif
+
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
 //     integrates with CPython, but also works on its own.
 //
@@ -8,6 +8,411 @@
 #include "nuitka/prelude.h"
 #endif
 
+#if PYTHON_VERSION >= 0x300
+// Raw reader on the read only memory of an embedded data file, used below a
+// buffered reader, so opening one does not copy the contents.
+struct Nuitka_EmbeddedDataFileReaderObject {
+    /* Python object folklore: */
+    PyObject_HEAD
+
+    // Memory view of the contents.
+    PyObject *m_view;
+
+    // File name, for the "name" attribute.
+    PyObject *m_name;
+
+    Py_ssize_t m_pos;
+    bool m_closed;
+};
+
+static void Nuitka_EmbeddedDataFileReader_tp_dealloc(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    Py_DECREF(reader->m_view);
+    Py_DECREF(reader->m_name);
+
+    PyObject_Del(reader);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_tp_repr(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return PyUnicode_FromFormat("<nuitka_embedded_data_file_reader name=%R>", reader->m_name);
+}
+
+static bool _checkEmbeddedDataFileReaderNotClosed(PyThreadState *tstate,
+                                                  struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    if (unlikely(reader->m_closed)) {
+        SET_CURRENT_EXCEPTION_TYPE0_STR(tstate, PyExc_ValueError, "I/O operation on closed file.");
+        return false;
+    }
+
+    return true;
+}
+
+// Size of the contents not read yet, seeking can go beyond the end.
+static Py_ssize_t _getEmbeddedDataFileReaderRemaining(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    Py_ssize_t remaining = PyMemoryView_GET_BUFFER(reader->m_view)->len - reader->m_pos;
+
+    return remaining > 0 ? remaining : 0;
+}
+
+static char const *_getEmbeddedDataFileReaderCurrent(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return (char const *)PyMemoryView_GET_BUFFER(reader->m_view)->buf + reader->m_pos;
+}
+
+static PyObject *_readEmbeddedDataFileReader(PyThreadState *tstate, struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                             Py_ssize_t size) {
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    Py_ssize_t remaining = _getEmbeddedDataFileReaderRemaining(reader);
+
+    if (size < 0 || size > remaining) {
+        size = remaining;
+    }
+
+    PyObject *result = Nuitka_Bytes_FromStringAndSize(_getEmbeddedDataFileReaderCurrent(reader), size);
+
+    if (likely(result != NULL)) {
+        reader->m_pos += size;
+    }
+
+    return result;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_read(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                    PyObject *args) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    Py_ssize_t size = -1;
+
+    if (unlikely(PyArg_ParseTuple(args, "|n:read", &size) == 0)) {
+        return NULL;
+    }
+
+    return _readEmbeddedDataFileReader(tstate, reader, size);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_readall(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    return _readEmbeddedDataFileReader(tstate, reader, -1);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_readinto(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                        PyObject *buffer) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    Py_buffer target;
+
+    if (unlikely(PyObject_GetBuffer(buffer, &target, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) == -1)) {
+        return NULL;
+    }
+
+    Py_ssize_t size = _getEmbeddedDataFileReaderRemaining(reader);
+
+    if (size > target.len) {
+        size = target.len;
+    }
+
+    memcpy(target.buf, _getEmbeddedDataFileReaderCurrent(reader), size);
+    reader->m_pos += size;
+
+    PyBuffer_Release(&target);
+
+    return PyLong_FromSsize_t(size);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_seek(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                    PyObject *args) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    Py_ssize_t pos;
+    int whence = 0;
+
+    if (unlikely(PyArg_ParseTuple(args, "n|i:seek", &pos, &whence) == 0)) {
+        return NULL;
+    }
+
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    if (whence == 1) {
+        pos += reader->m_pos;
+    } else if (whence == 2) {
+        pos += PyMemoryView_GET_BUFFER(reader->m_view)->len;
+    } else if (unlikely(whence != 0)) {
+        PyErr_Format(PyExc_ValueError, "invalid whence (%d, should be 0, 1 or 2)", whence);
+        return NULL;
+    }
+
+    if (unlikely(pos < 0)) {
+        PyErr_Format(PyExc_ValueError, "negative seek value %zd", pos);
+        return NULL;
+    }
+
+    reader->m_pos = pos;
+
+    return PyLong_FromSsize_t(pos);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_tell(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    return PyLong_FromSsize_t(reader->m_pos);
+}
+
+// Answers for "readable", "seekable", and "isatty" of open files.
+static PyObject *_getEmbeddedDataFileReaderAnswer(struct Nuitka_EmbeddedDataFileReaderObject *reader, bool value) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    PyObject *result = BOOL_FROM(value);
+    Py_INCREF_IMMORTAL(result);
+    return result;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_readable(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return _getEmbeddedDataFileReaderAnswer(reader, true);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_writable(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return _getEmbeddedDataFileReaderAnswer(reader, false);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_seekable(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return _getEmbeddedDataFileReaderAnswer(reader, true);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_isatty(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    return _getEmbeddedDataFileReaderAnswer(reader, false);
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_flush(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (unlikely(_checkEmbeddedDataFileReaderNotClosed(tstate, reader) == false)) {
+        return NULL;
+    }
+
+    Py_INCREF_IMMORTAL(Py_None);
+    return Py_None;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_close(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    reader->m_closed = true;
+
+    Py_INCREF_IMMORTAL(Py_None);
+    return Py_None;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_fileno(struct Nuitka_EmbeddedDataFileReaderObject *reader) {
+    PyObject *unsupported_operation = PyObject_GetAttrString(IMPORT_HARD__IO(), "UnsupportedOperation");
+
+    if (likely(unsupported_operation != NULL)) {
+        PyErr_SetString(unsupported_operation, "fileno");
+        Py_DECREF(unsupported_operation);
+    }
+
+    return NULL;
+}
+
+static PyMethodDef Nuitka_EmbeddedDataFileReader_methods[] = {
+    {"read", (PyCFunction)Nuitka_EmbeddedDataFileReader_read, METH_VARARGS, NULL},
+    {"readall", (PyCFunction)Nuitka_EmbeddedDataFileReader_readall, METH_NOARGS, NULL},
+    {"readinto", (PyCFunction)Nuitka_EmbeddedDataFileReader_readinto, METH_O, NULL},
+    {"seek", (PyCFunction)Nuitka_EmbeddedDataFileReader_seek, METH_VARARGS, NULL},
+    {"tell", (PyCFunction)Nuitka_EmbeddedDataFileReader_tell, METH_NOARGS, NULL},
+    {"readable", (PyCFunction)Nuitka_EmbeddedDataFileReader_readable, METH_NOARGS, NULL},
+    {"writable", (PyCFunction)Nuitka_EmbeddedDataFileReader_writable, METH_NOARGS, NULL},
+    {"seekable", (PyCFunction)Nuitka_EmbeddedDataFileReader_seekable, METH_NOARGS, NULL},
+    {"isatty", (PyCFunction)Nuitka_EmbeddedDataFileReader_isatty, METH_NOARGS, NULL},
+    {"flush", (PyCFunction)Nuitka_EmbeddedDataFileReader_flush, METH_NOARGS, NULL},
+    {"close", (PyCFunction)Nuitka_EmbeddedDataFileReader_close, METH_NOARGS, NULL},
+    {"fileno", (PyCFunction)Nuitka_EmbeddedDataFileReader_fileno, METH_NOARGS, NULL},
+    {NULL}};
+
+static PyObject *Nuitka_EmbeddedDataFileReader_get_closed(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                          void *data) {
+    PyObject *result = BOOL_FROM(reader->m_closed);
+    Py_INCREF_IMMORTAL(result);
+    return result;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_get_name(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                        void *data) {
+    Py_INCREF(reader->m_name);
+    return reader->m_name;
+}
+
+static PyObject *Nuitka_EmbeddedDataFileReader_get_mode(struct Nuitka_EmbeddedDataFileReaderObject *reader,
+                                                        void *data) {
+    return Nuitka_String_FromString("rb");
+}
+
+static PyGetSetDef Nuitka_EmbeddedDataFileReader_tp_getset[] = {
+    {(char *)"closed", (getter)Nuitka_EmbeddedDataFileReader_get_closed, NULL, NULL},
+    {(char *)"name", (getter)Nuitka_EmbeddedDataFileReader_get_name, NULL, NULL},
+    {(char *)"mode", (getter)Nuitka_EmbeddedDataFileReader_get_mode, NULL, NULL},
+    {NULL}};
+
+static PyTypeObject Nuitka_EmbeddedDataFileReader_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0) "nuitka_embedded_data_file_reader",
+    sizeof(struct Nuitka_EmbeddedDataFileReaderObject),   // tp_basicsize
+    0,                                                    // tp_itemsize
+    (destructor)Nuitka_EmbeddedDataFileReader_tp_dealloc, // tp_dealloc
+    0,                                                    // tp_print
+    0,                                                    // tp_getattr
+    0,                                                    // tp_setattr
+    0,                                                    // tp_reserved
+    (reprfunc)Nuitka_EmbeddedDataFileReader_tp_repr,      // tp_repr
+    0,                                                    // tp_as_number
+    0,                                                    // tp_as_sequence
+    0,                                                    // tp_as_mapping
+    0,                                                    // tp_hash
+    0,                                                    // tp_call
+    0,                                                    // tp_str
+    0,                                                    // tp_getattro (PyObject_GenericGetAttr)
+    0,                                                    // tp_setattro
+    0,                                                    // tp_as_buffer
+    Py_TPFLAGS_DEFAULT,                                   // tp_flags
+    0,                                                    // tp_doc
+    0,                                                    // tp_traverse
+    0,                                                    // tp_clear
+    0,                                                    // tp_richcompare
+    0,                                                    // tp_weaklistoffset
+    0,                                                    // tp_iter
+    0,                                                    // tp_iternext
+    Nuitka_EmbeddedDataFileReader_methods,                // tp_methods
+    0,                                                    // tp_members
+    Nuitka_EmbeddedDataFileReader_tp_getset,              // tp_getset
+};
+
+static PyObject *Nuitka_EmbeddedDataFileReader_New(PyThreadState *tstate, PyObject *view, PyObject *name) {
+    static bool init_done = false;
+    if (init_done == false) {
+        Nuitka_PyType_Ready(&Nuitka_EmbeddedDataFileReader_Type, NULL, true, false, false, false, false);
+
+        init_done = true;
+    }
+
+    struct Nuitka_EmbeddedDataFileReaderObject *result =
+        PyObject_New(struct Nuitka_EmbeddedDataFileReaderObject, &Nuitka_EmbeddedDataFileReader_Type);
+
+    if (unlikely(result == NULL)) {
+        return NULL;
+    }
+
+    result->m_view = view;
+    Py_INCREF(view);
+    result->m_name = name;
+    Py_INCREF(name);
+    result->m_pos = 0;
+    result->m_closed = false;
+
+    return (PyObject *)result;
+}
+#endif
+
+// Embedded data files are opened as streams on their contents, for reading
+// only, other modes are left to a normal open.
+bool OPEN_EMBEDDED_DATA_FILE(PyThreadState *tstate, PyObject *file_name, PyObject *mode, PyObject *encoding,
+                             PyObject *errors, PyObject *newline, PyObject **result) {
+    char const *mode_str = "r";
+
+    if (mode != NULL) {
+        if (!Nuitka_String_CheckExact(mode)) {
+            return false;
+        }
+
+        mode_str = Nuitka_String_AsString(mode);
+
+        if (strpbrk(mode_str, "wax+") != NULL) {
+            return false;
+        }
+    }
+
+    struct Nuitka_EmbeddedDataFileEntry const *data_file = findEmbeddedDataFile(tstate, file_name);
+
+    if (data_file == NULL) {
+        return false;
+    }
+
+#if PYTHON_VERSION >= 0x300
+    PyObject *view = getEmbeddedDataFileMemoryView(data_file);
+
+    if (unlikely(view == NULL)) {
+        *result = NULL;
+        return true;
+    }
+
+    PyObject *raw_stream = Nuitka_EmbeddedDataFileReader_New(tstate, view, file_name);
+    Py_DECREF(view);
+
+    if (unlikely(raw_stream == NULL)) {
+        *result = NULL;
+        return true;
+    }
+
+    // TODO: Hard import code could be used for this.
+    static PyObject *_io_module_buffered_reader = NULL;
+    if (_io_module_buffered_reader == NULL) {
+        _io_module_buffered_reader = PyObject_GetAttrString(IMPORT_HARD__IO(), "BufferedReader");
+        CHECK_OBJECT(_io_module_buffered_reader);
+    }
+
+    PyObject *binary_stream = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, _io_module_buffered_reader, raw_stream);
+    Py_DECREF(raw_stream);
+
+    if (binary_stream != NULL && strchr(mode_str, 'b') == NULL) {
+        // TODO: Hard import code could be used for this.
+        static PyObject *_io_module_text_io_wrapper = NULL;
+        if (_io_module_text_io_wrapper == NULL) {
+            _io_module_text_io_wrapper = PyObject_GetAttrString(IMPORT_HARD__IO(), "TextIOWrapper");
+            CHECK_OBJECT(_io_module_text_io_wrapper);
+        }
+
+        PyObject *args[] = {binary_stream, encoding != NULL ? encoding : Py_None, errors != NULL ? errors : Py_None,
+                            newline != NULL ? newline : Py_None};
+        *result = CALL_FUNCTION_WITH_ARGS4(tstate, _io_module_text_io_wrapper, args);
+
+        Py_DECREF(binary_stream);
+
+        return true;
+    }
+#else
+    // TODO: Hard import code could be used for this.
+    static PyObject *_io_module_bytes_io = NULL;
+    if (_io_module_bytes_io == NULL) {
+        _io_module_bytes_io = PyObject_GetAttrString(IMPORT_HARD__IO(), "BytesIO");
+        CHECK_OBJECT(_io_module_bytes_io);
+    }
+
+    PyObject *data = getEmbeddedDataFileBytes(data_file);
+
+    if (unlikely(data == NULL)) {
+        *result = NULL;
+        return true;
+    }
+
+    PyObject *binary_stream = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, _io_module_bytes_io, data);
+    Py_DECREF(data);
+#endif
+
+    *result = binary_stream;
+    return true;
+}
+
 // Small helper to open files with few arguments.
 PyObject *BUILTIN_OPEN_SIMPLE(PyThreadState *tstate, PyObject *filename, char const *mode, bool buffering,
                               PyObject *encoding) {
@@ -89,6 +494,12 @@ PyObject *GET_FILE_BYTES(PyThreadState *tstate, PyObject *filename) {
         return result;
     }
 
+    struct Nuitka_EmbeddedDataFileEntry const *embedded_data_file = findEmbeddedDataFile(tstate, filename);
+
+    if (embedded_data_file != NULL) {
+        return getEmbeddedDataFileBytes(embedded_data_file);
+    }
+
     PyObject *data_file = BUILTIN_OPEN_BINARY_READ_SIMPLE(tstate, filename);
 
     if (unlikely(data_file == NULL)) {
@@ -128,6 +539,20 @@ PyObject *OS_PATH_FILE_EXISTS(PyThreadState *tstate, PyObject *filename) {
         return result;
     }
 
+    if (findEmbeddedDataFile(tstate, filename) != NULL) {
+        Py_INCREF_IMMORTAL(Py_True);
+        return Py_True;
+    }
+
+    PyObject *embedded_names = getEmbeddedDataDirectoryNames(tstate, filename);
+
+    if (embedded_names != NULL) {
+        Py_DECREF(embedded_names);
+
+        Py_INCREF_IMMORTAL(Py_True);
+        return Py_True;
+    }
+
     PyObject *exists_func = LOOKUP_ATTRIBUTE(tstate, IMPORT_HARD_OS_PATH(tstate), const_str_plain_exists);
 
     result = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, exists_func, filename);
@@ -143,6 +568,11 @@ PyObject *OS_PATH_FILE_ISFILE(PyThreadState *tstate, PyObject *filename) {
         return result;
     }
 
+    if (findEmbeddedDataFile(tstate, filename) != NULL) {
+        Py_INCREF_IMMORTAL(Py_True);
+        return Py_True;
+    }
+
     PyObject *isfile_func = LOOKUP_ATTRIBUTE(tstate, IMPORT_HARD_OS_PATH(tstate), const_str_plain_isfile);
 
     result = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, isfile_func, filename);
@@ -158,6 +588,15 @@ PyObject *OS_PATH_FILE_ISDIR(PyThreadState *tstate, PyObject *filename) {
         return result;
     }
 
+    PyObject *embedded_names = getEmbeddedDataDirectoryNames(tstate, filename);
+
+    if (embedded_names != NULL) {
+        Py_DECREF(embedded_names);
+
+        Py_INCREF_IMMORTAL(Py_True);
+        return Py_True;
+    }
+
     PyObject *isdir_func = LOOKUP_ATTRIBUTE(tstate, IMPORT_HARD_OS_PATH(tstate), const_str_plain_isdir);
 
     result = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, isdir_func, filename);
@@ -182,6 +621,41 @@ PyObject *OS_LISTDIR(PyThreadState *tstate, PyObject *path) {
     }
 
     Py_DECREF(listdir_func);
+
+    // Add the embedded data files, the directory need not exist at all, if
+    // it only contained these.
+    PyObject *embedded_names = path != NULL ? getEmbeddedDataDirectoryNames(tstate, path) : NULL;
+
+    if (embedded_names != NULL) {
+        if (result == NULL) {
+            if (!_CHECK_AND_CLEAR_EXCEPTION_OCCURRED(tstate, PyExc_OSError)) {
+                Py_DECREF(embedded_names);
+                return NULL;
+            }
+
+            return embedded_names;
+        }
+
+        Py_ssize_t n = PyList_GET_SIZE(embedded_names);
+        for (Py_ssize_t i = 0; i < n; i++) {
+            PyObject *name = PyList_GET_ITEM(embedded_names, i);
+
+            int res = PySequence_Contains(result, name);
+
+            if (unlikely(res == -1)) {
+                Py_DECREF(embedded_names);
+                Py_DECREF(result);
+                return NULL;
+            }
+
+            if (res == 0) {
+                LIST_APPEND0(result, name);
+            }
+        }
+
+        Py_DECREF(embedded_names);
+    }
+
     return result;
 }
 
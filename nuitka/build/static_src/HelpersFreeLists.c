@@ -0,0 +1,123 @@
+//     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+// Per thread free lists of compiled objects, for Python without the GIL, see
+// "nuitka/freelists.h" for the macros using them.
+
+// This file is included from another C file, help IDEs to still parse it on
+// its own.
+#ifdef __IDE_ONLY__
+#include "nuitka/prelude.h"
+#endif
+
+#include "nuitka/freelists.h"
+
+#ifdef Py_GIL_DISABLED
+
+_Thread_local struct Nuitka_ThreadFreeLists Nuitka_thread_free_lists;
+
+static void _Nuitka_ClearFreeList(void **free_list, int *free_list_count) {
+    while (*free_list != NULL) {
+        void *object = *free_list;
+        *free_list = *((void **)object);
+
+        PyObject_GC_Del(object);
+    }
+
+    *free_list_count = 0;
+}
+
+#define CLEAR_THREAD_FREE_LIST(free_lists, free_list)                                                                  \
+    _Nuitka_ClearFreeList((void **)&free_lists->free_list, &free_lists->free_list##_count)
+
+static void Nuitka_ThreadFreeLists_Release(PyObject *capsule) {
+    struct Nuitka_ThreadFreeLists *free_lists =
+        (struct Nuitka_ThreadFreeLists *)PyCapsule_GetPointer(capsule, "nuitka_free_lists");
+
+    // Thread states of other threads can be cleared too, e.g. at exit. Their
+    // objects are not touched then, the thread may still be using them.
+    if (free_lists != &Nuitka_thread_free_lists) {
+        return;
+    }
+
+    free_lists->released_tstate = free_lists->tstate;
+    free_lists->tstate = NULL;
+
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_frames);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_functions);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_methods);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_cells);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_generators);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_coros);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_coro_wrappers);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_coroutine_aiter_wrappers);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_asyncgens);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_asyncgen_value_wrappers);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_asyncgen_asends);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_asyncgen_athrows);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_tracebacks);
+    CLEAR_THREAD_FREE_LIST(free_lists, free_list_loaders);
+}
+
+bool Nuitka_AttachThreadFreeLists(PyThreadState *tstate) {
+    struct Nuitka_ThreadFreeLists *free_lists = &Nuitka_thread_free_lists;
+
+    // Another thread state of this thread is using the lists, or the thread
+    // state is being cleared, and gave them up already.
+    if (free_lists->tstate != NULL || free_lists->released_tstate == tstate) {
+        return false;
+    }
+
+    // This happens during deallocation, where an exception may be set, that
+    // must be preserved.
+    struct Nuitka_ExceptionPreservationItem saved_exception_state;
+    FETCH_ERROR_OCCURRED_STATE(tstate, &saved_exception_state);
+
+    bool result = false;
+
+    PyObject *thread_dict = PyThreadState_GetDict();
+
+    if (thread_dict != NULL) {
+        PyObject *capsule = PyCapsule_New(free_lists, "nuitka_free_lists", Nuitka_ThreadFreeLists_Release);
+
+        if (capsule != NULL) {
+            // Every extension module compiled has its own lists, so the key
+            // must be unique.
+            PyObject *key = PyUnicode_FromFormat("__nuitka_free_lists_%p__", free_lists);
+
+            if (key != NULL) {
+                result = PyDict_SetItem(thread_dict, key, capsule) == 0;
+
+                Py_DECREF(key);
+            }
+
+            Py_DECREF(capsule);
+        }
+    }
+
+    if (result) {
+        free_lists->tstate = tstate;
+    } else {
+        CLEAR_ERROR_OCCURRED(tstate);
+    }
+
+    RESTORE_ERROR_OCCURRED_STATE(tstate, &saved_exception_state);
+
+    return result;
+}
+
+#endif
+
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
@@ -726,6 +726,82 @@ void LIST_REVERSE(PyObject *list) {
     }
 }
 
+#if PYTHON_VERSION >= 0x300
+// The sorting itself is left to CPython, as its "timsort" already checks for
+// homogeneous "int", "float", and "str" keys and then uses specialized compares
+// instead of the rich comparison, and a different algorithm would give other
+// results for inconsistent orders, e.g. with "NaN" values. What we can improve
+// is the key call, for compiled functions as keys, where CPython would use the
+// generic call protocol for each item.
+static PyObject *_Nuitka_ListSortCompiledKey(PyObject *function, PyObject *item) {
+    PyThreadState *tstate = PyThreadState_GET();
+
+    return CALL_FUNCTION_WITH_SINGLE_ARG(tstate, function, item);
+}
+
+static PyMethodDef _Nuitka_ListSortCompiledKeyMethodDef = {"key", (PyCFunction)_Nuitka_ListSortCompiledKey, METH_O,
+                                                           NULL};
+
+static PyObject *list_sort_kw_names = NULL;
+
+static PyObject *_LIST_SORT_COMMON(PyThreadState *tstate, PyObject *list, PyObject *key, PyObject *reverse) {
+    CHECK_OBJECT(list);
+    assert(PyList_CheckExact(list));
+    CHECK_OBJECT(key);
+    CHECK_OBJECT(reverse);
+
+    if (key == Py_None && reverse == Py_False) {
+        if (unlikely(PyList_Sort(list) != 0)) {
+            return NULL;
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    if (unlikely(list_sort_kw_names == NULL)) {
+        list_sort_kw_names = MAKE_TUPLE_EMPTY(tstate, 2);
+        PyTuple_SET_ITEM(list_sort_kw_names, 0, Nuitka_String_FromString("key"));
+        PyTuple_SET_ITEM(list_sort_kw_names, 1, Nuitka_String_FromString("reverse"));
+    }
+
+    PyObject *key_function;
+
+    // Compiled functions get called directly by a wrapper, that CPython can
+    // call cheaply.
+    if (Nuitka_Function_Check(key)) {
+        key_function = PyCFunction_New(&_Nuitka_ListSortCompiledKeyMethodDef, key);
+
+        if (unlikely(key_function == NULL)) {
+            return NULL;
+        }
+    } else {
+        key_function = key;
+        Py_INCREF(key_function);
+    }
+
+    PyObject *kw_values[2] = {key_function, reverse};
+
+    PyObject *result = CALL_FUNCTION_WITH_ARGS1_KWSPLIT(tstate, list_builtin_sort, &list, kw_values, list_sort_kw_names);
+
+    Py_DECREF(key_function);
+
+    return result;
+}
+
+PyObject *LIST_SORT1(PyThreadState *tstate, PyObject *list) {
+    return _LIST_SORT_COMMON(tstate, list, Py_None, Py_False);
+}
+
+PyObject *LIST_SORT2(PyThreadState *tstate, PyObject *list, PyObject *key) {
+    return _LIST_SORT_COMMON(tstate, list, key, Py_False);
+}
+
+PyObject *LIST_SORT3(PyThreadState *tstate, PyObject *list, PyObject *key, PyObject *reverse) {
+    return _LIST_SORT_COMMON(tstate, list, key != NULL ? key : Py_None, reverse);
+}
+#endif
+
 #if PYTHON_VERSION >= 0x340 && !defined(_NUITKA_EXPERIMENTAL_DISABLE_LIST_OPT)
 static bool allocateListItems(PyListObject *list, Py_ssize_t size) {
     PyObject **items = PyMem_New(PyObject *, size);
@@ -1,7 +1,8 @@
 //     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
 
 /**
- * This is responsible for profiling Nuitka using "vmprof".
+ * This is responsible for profiling Nuitka using "vmprof", or with the built-in
+ * sampling profiler, that needs no extra modules.
  */
 
 #if _NUITKA_PROFILE
@@ -88,6 +89,321 @@ void stopProfiling(void) {
 
 #endif
 
+#if _NUITKA_PROFILE_SAMPLING
+
+#include <signal.h>
+#include <sys/time.h>
+
+// Samples are taken in a signal handler, where neither allocation nor the use
+// of Python API is allowed, so all storage is preallocated, and the names of
+// the code objects get copied out of them, when they are first seen on the
+// stack, as they are not safe to use later.
+
+#define NUITKA_PROFILE_MAX_DEPTH 128
+#define NUITKA_PROFILE_LOCATIONS_SIZE 65536
+#define NUITKA_PROFILE_NAMES_SIZE (4 * 1024 * 1024)
+#define NUITKA_PROFILE_SAMPLES_SIZE (8 * 1024 * 1024)
+
+// Location ID used when the tables are full.
+#define NUITKA_PROFILE_UNKNOWN_LOCATION NUITKA_PROFILE_LOCATIONS_SIZE
+
+struct Nuitka_ProfileLocation {
+    // Only a key, the code object is not used after the sample was taken.
+    void const *code;
+    int line;
+
+    // Offset of the zero terminated description in "profile_names".
+    uint32_t name_offset;
+};
+
+static struct Nuitka_ProfileLocation *profile_locations;
+static uint32_t profile_locations_used = 0;
+
+static char *profile_names;
+static uint32_t profile_names_used = 0;
+
+// Each sample is its depth, followed by location IDs, innermost first.
+static uint32_t *profile_samples;
+static uint32_t profile_samples_used = 0;
+
+static uint32_t profile_samples_dropped = 0;
+
+static volatile int profile_sampling_busy = 0;
+
+static struct sigaction profile_old_sigaction;
+
+static void appendProfileName(char const *value, Py_ssize_t size) {
+    // Always leave room for the terminator.
+    if (size > NUITKA_PROFILE_NAMES_SIZE - 1 - (Py_ssize_t)profile_names_used) {
+        size = NUITKA_PROFILE_NAMES_SIZE - 1 - (Py_ssize_t)profile_names_used;
+    }
+
+    for (Py_ssize_t i = 0; i < size; i++) {
+        char c = value[i];
+
+        // These would break the collapsed stack format.
+        if (c == ';' || c == '\n') {
+            c = '_';
+        }
+
+        profile_names[profile_names_used++] = c;
+    }
+}
+
+static void appendProfileNameString(PyObject *value) {
+#if PYTHON_VERSION < 0x300
+    if (PyString_Check(value)) {
+        appendProfileName(PyString_AS_STRING(value), PyString_GET_SIZE(value));
+        return;
+    }
+#else
+    if (PyUnicode_Check(value) && PyUnicode_IS_COMPACT_ASCII(value)) {
+        appendProfileName((char const *)(((PyASCIIObject *)value) + 1), ((PyASCIIObject *)value)->length);
+        return;
+    }
+#endif
+
+    appendProfileName("?", 1);
+}
+
+static void appendProfileNameInt(int value) {
+    char buffer[16];
+    int pos = sizeof(buffer);
+
+    do {
+        buffer[--pos] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0 && pos > 0);
+
+    appendProfileName(&buffer[pos], sizeof(buffer) - pos);
+}
+
+static uint32_t getProfileLocation(PyCodeObject *code, int line) {
+    if (line <= 0) {
+        line = code->co_firstlineno;
+    }
+
+    uintptr_t hash = ((uintptr_t)code >> 4) * 31 + (uintptr_t)line;
+    uint32_t mask = NUITKA_PROFILE_LOCATIONS_SIZE - 1;
+    uint32_t index = (uint32_t)(hash ^ (hash >> 16)) & mask;
+
+    for (;;) {
+        struct Nuitka_ProfileLocation *location = &profile_locations[index];
+
+        if (location->code == code && location->line == line) {
+            return index;
+        }
+
+        if (location->code == NULL) {
+            break;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    // Keep the table sparse, and leave room for names.
+    if (profile_locations_used * 4 >= NUITKA_PROFILE_LOCATIONS_SIZE * 3 ||
+        profile_names_used + 1024 >= NUITKA_PROFILE_NAMES_SIZE) {
+        return NUITKA_PROFILE_UNKNOWN_LOCATION;
+    }
+
+    struct Nuitka_ProfileLocation *location = &profile_locations[index];
+
+    location->code = code;
+    location->line = line;
+    location->name_offset = profile_names_used;
+
+    appendProfileNameString(code->co_name);
+    appendProfileName(" (", 2);
+    appendProfileNameString(code->co_filename);
+    appendProfileName(":", 1);
+    appendProfileNameInt(line);
+    appendProfileName(")", 1);
+    profile_names[profile_names_used++] = 0;
+
+    profile_locations_used += 1;
+
+    return index;
+}
+
+static void takeProfileSample(PyThreadState *tstate) {
+    uint32_t stack[NUITKA_PROFILE_MAX_DEPTH];
+    uint32_t depth = 0;
+
+#if PYTHON_VERSION < 0x3b0
+    PyFrameObject *frame = tstate->frame;
+
+    while (frame != NULL && depth < NUITKA_PROFILE_MAX_DEPTH) {
+        int line;
+
+        // Compiled frames maintain the line number in their frame object, for
+        // uncompiled ones it is only current when tracing, compute it instead.
+        if (Nuitka_Frame_CheckExact((PyObject *)frame)) {
+            line = frame->f_lineno;
+        } else {
+            line = PyFrame_GetLineNumber(frame);
+        }
+
+        stack[depth++] = getProfileLocation(frame->f_code, line);
+
+        frame = frame->f_back;
+    }
+#else
+    _PyInterpreterFrame *frame = CURRENT_TSTATE_INTERPRETER_FRAME(tstate);
+
+    while (frame != NULL && depth < NUITKA_PROFILE_MAX_DEPTH) {
+        if (!_PyFrame_IsIncomplete(frame)) {
+            PyCodeObject *code = Nuitka_InterpreterFrame_GetCodeObject(frame);
+
+            if (PyCode_Check(code)) {
+                int line;
+
+                // Compiled frames maintain the line number in their frame object, for
+                // uncompiled ones it is only there when tracing, compute it instead.
+                if (frame->frame_obj != NULL && Nuitka_Frame_CheckExact((PyObject *)frame->frame_obj)) {
+                    line = frame->frame_obj->f_lineno;
+                } else {
+                    line = PyCode_Addr2Line(code, _PyInterpreterFrame_LASTI(frame) * sizeof(_Py_CODEUNIT));
+                }
+
+                stack[depth++] = getProfileLocation(code, line);
+            }
+        }
+
+        frame = frame->previous;
+    }
+#endif
+
+    if (depth == 0) {
+        return;
+    }
+
+    if (profile_samples_used + depth + 1 > NUITKA_PROFILE_SAMPLES_SIZE) {
+        profile_samples_dropped += 1;
+        return;
+    }
+
+    profile_samples[profile_samples_used++] = depth;
+
+    for (uint32_t i = 0; i < depth; i++) {
+        profile_samples[profile_samples_used++] = stack[i];
+    }
+}
+
+static void onProfileSignal(int signal_number) {
+    int old_errno = errno;
+
+    // Another thread may be taking a sample at the same time, do not wait
+    // for it inside a signal handler.
+    if (__sync_lock_test_and_set(&profile_sampling_busy, 1) == 0) {
+        PyThreadState *tstate = PyGILState_GetThisThreadState();
+
+        if (tstate != NULL) {
+            takeProfileSample(tstate);
+        }
+
+        __sync_lock_release(&profile_sampling_busy);
+    } else {
+        profile_samples_dropped += 1;
+    }
+
+    errno = old_errno;
+}
+
+void startSamplingProfiler(void) {
+    profile_locations = (struct Nuitka_ProfileLocation *)calloc(NUITKA_PROFILE_LOCATIONS_SIZE,
+                                                                sizeof(struct Nuitka_ProfileLocation));
+    profile_names = (char *)malloc(NUITKA_PROFILE_NAMES_SIZE);
+    profile_samples = (uint32_t *)malloc(NUITKA_PROFILE_SAMPLES_SIZE * sizeof(uint32_t));
+
+    if (unlikely(profile_locations == NULL || profile_names == NULL || profile_samples == NULL)) {
+        fprintf(stderr, "Error, failed to allocate sampling profiler storage.\n");
+        abort();
+    }
+
+    long interval = 1000;
+
+    char const *interval_spec = getenv("NUITKA_PROFILE_INTERVAL");
+    if (interval_spec != NULL && atol(interval_spec) > 0) {
+        interval = atol(interval_spec);
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onProfileSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    sigaction(SIGPROF, &action, &profile_old_sigaction);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval / 1000000;
+    timer.it_interval.tv_usec = interval % 1000000;
+    timer.it_value = timer.it_interval;
+
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+void stopSamplingProfiler(void) {
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    // Ignoring the signal discards ones still pending on other threads, which
+    // with the default action would terminate the process.
+    signal(SIGPROF, SIG_IGN);
+
+    // Wait for a sample that might be taken right now.
+    while (__sync_lock_test_and_set(&profile_sampling_busy, 1) != 0) {
+    }
+
+    sigaction(SIGPROF, &profile_old_sigaction, NULL);
+
+    char const *output_filename = getenv("NUITKA_PROFILE_OUTPUT");
+    if (output_filename == NULL) {
+        output_filename = "nuitka-profile.collapsed";
+    }
+
+    FILE *output_file = fopen(output_filename, "w");
+
+    if (output_file == NULL) {
+        fprintf(stderr, "Error, failed to open '%s' for writing profile.\n", output_filename);
+        return;
+    }
+
+    // Collapsed stacks, outermost frame first, separated by semicolons, and
+    // followed by the count. Tools reading it, add up identical stacks.
+    for (uint32_t pos = 0; pos < profile_samples_used;) {
+        uint32_t depth = profile_samples[pos++];
+
+        for (uint32_t i = depth; i > 0; i--) {
+            uint32_t location_id = profile_samples[pos + i - 1];
+
+            if (i != depth) {
+                fputc(';', output_file);
+            }
+
+            if (location_id == NUITKA_PROFILE_UNKNOWN_LOCATION) {
+                fputs("[unknown]", output_file);
+            } else {
+                fputs(&profile_names[profile_locations[location_id].name_offset], output_file);
+            }
+        }
+
+        fputs(" 1\n", output_file);
+
+        pos += depth;
+    }
+
+    fclose(output_file);
+
+    if (profile_samples_dropped > 0) {
+        fprintf(stderr, "Nuitka: Sampling profiler dropped %u samples.\n", profile_samples_dropped);
+    }
+}
+
+#endif
+
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
 //     integrates with CPython, but also works on its own.
 //
@@ -13,34 +13,123 @@
 
 static FILE *pgo_output;
 
+// Output is collected in blocks, and only written when one is full, to avoid
+// many small writes for every probe.
+#define PGO_OUTPUT_BUFFER_SIZE (1024 * 1024)
+
+static unsigned char *PGO_OutputBuffer = NULL;
+static size_t PGO_OutputBuffer_used = 0;
+
+static void PGO_flushOutput(void) {
+    if (PGO_OutputBuffer_used > 0) {
+        size_t written = fwrite(PGO_OutputBuffer, 1, PGO_OutputBuffer_used, pgo_output);
+
+        if (unlikely(written != PGO_OutputBuffer_used)) {
+            fprintf(stderr, "Error, failed to write PGO information.\n");
+            exit(27);
+        }
+
+        PGO_OutputBuffer_used = 0;
+    }
+}
+
+static void PGO_writeOutput(void const *data, size_t size) {
+    if (unlikely(PGO_OutputBuffer_used + size > PGO_OUTPUT_BUFFER_SIZE)) {
+        PGO_flushOutput();
+
+        if (unlikely(size > PGO_OUTPUT_BUFFER_SIZE)) {
+            size_t written = fwrite(data, 1, size, pgo_output);
+
+            if (unlikely(written != size)) {
+                fprintf(stderr, "Error, failed to write PGO information.\n");
+                exit(27);
+            }
+
+            return;
+        }
+    }
+
+    memcpy(PGO_OutputBuffer + PGO_OutputBuffer_used, data, size);
+    PGO_OutputBuffer_used += size;
+}
+
 // Saving space by not repeating strings.
 
-// Allocated strings
+// Allocated strings, in order of their ID.
 static char const **PGO_ProbeNameMappings = NULL;
 uint32_t PGO_ProbeNameMappings_size = 0;
 uint32_t PGO_ProbeNameMappings_used = 0;
 
-uint32_t PGO_getStringID(char const *str) {
+// Hash table from string pointer to its ID plus one, zero is an unused slot. It
+// is kept at least twice as large as the mappings, so it never fills up.
+static uint32_t *PGO_ProbeNameIndex = NULL;
+static uint32_t PGO_ProbeNameIndex_size = 0;
+
+static uint32_t PGO_hashStringPointer(char const *str) {
+    uintptr_t hash = (uintptr_t)str;
+
+    // Strings are not usually aligned, but mix in the high bits anyway.
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bU;
+    hash ^= hash >> 16;
+
+    return (uint32_t)hash;
+}
+
+static uint32_t *PGO_findStringIndexSlot(char const *str) {
+    uint32_t mask = PGO_ProbeNameIndex_size - 1;
+    uint32_t index = PGO_hashStringPointer(str) & mask;
+
+    while (PGO_ProbeNameIndex[index] != 0 && PGO_ProbeNameMappings[PGO_ProbeNameIndex[index] - 1] != str) {
+        index = (index + 1) & mask;
+    }
+
+    return &PGO_ProbeNameIndex[index];
+}
+
+static void PGO_growStrings(void) {
+    PGO_ProbeNameMappings_size *= 2;
+    PGO_ProbeNameMappings =
+        (char const **)realloc(PGO_ProbeNameMappings, PGO_ProbeNameMappings_size * sizeof(char const *));
+
+    free(PGO_ProbeNameIndex);
+
+    PGO_ProbeNameIndex_size = PGO_ProbeNameMappings_size * 2;
+    PGO_ProbeNameIndex = (uint32_t *)calloc(PGO_ProbeNameIndex_size, sizeof(uint32_t));
+
+    if (unlikely(PGO_ProbeNameMappings == NULL || PGO_ProbeNameIndex == NULL)) {
+        NUITKA_CANNOT_GET_HERE("Out of memory for PGO strings");
+    }
+
     for (uint32_t i = 0; i < PGO_ProbeNameMappings_used; i++) {
-        if (str == PGO_ProbeNameMappings[i]) {
-            return i;
-        }
+        *PGO_findStringIndexSlot(PGO_ProbeNameMappings[i]) = i + 1;
+    }
+}
+
+uint32_t PGO_getStringID(char const *str) {
+    uint32_t *slot = PGO_findStringIndexSlot(str);
+
+    if (likely(*slot != 0)) {
+        return *slot - 1;
     }
 
-    if (PGO_ProbeNameMappings_used == PGO_ProbeNameMappings_size) {
-        PGO_ProbeNameMappings_size += 10000;
-        PGO_ProbeNameMappings = realloc(PGO_ProbeNameMappings, PGO_ProbeNameMappings_size);
+    if (unlikely(PGO_ProbeNameMappings_used == PGO_ProbeNameMappings_size)) {
+        PGO_growStrings();
+
+        slot = PGO_findStringIndexSlot(str);
     }
 
     PGO_ProbeNameMappings[PGO_ProbeNameMappings_used] = str;
     PGO_ProbeNameMappings_used += 1;
 
+    *slot = PGO_ProbeNameMappings_used;
+
     return PGO_ProbeNameMappings_used - 1;
 }
 
 static void PGO_writeString(char const *value) {
     uint32_t id = PGO_getStringID(value);
-    fwrite(&id, sizeof(id), 1, pgo_output);
+    PGO_writeOutput(&id, sizeof(id));
 }
 
 void PGO_Initialize(void) {
@@ -54,32 +143,73 @@ void PGO_Initialize(void) {
 
     pgo_output = fopen(output_filename, "wb");
 
-    if (unlikely(output_filename == NULL)) {
+    if (unlikely(pgo_output == NULL)) {
         fprintf(stderr, "Error, failed to open '%s' for writing.", output_filename);
         exit(27);
     }
 
-    fputs("KAY.PGO", pgo_output);
-    fflush(pgo_output);
+    PGO_OutputBuffer = (unsigned char *)malloc(PGO_OUTPUT_BUFFER_SIZE);
 
-    PGO_ProbeNameMappings_size = 10000;
-    PGO_ProbeNameMappings = malloc(PGO_ProbeNameMappings_size * sizeof(char const *));
+    if (unlikely(PGO_OutputBuffer == NULL)) {
+        fprintf(stderr, "Error, failed to allocate PGO output buffer.\n");
+        exit(27);
+    }
+
+    PGO_writeOutput("KAY.PGO", 7);
+
+    PGO_ProbeNameMappings_size = 8192;
+    PGO_ProbeNameMappings = (char const **)malloc(PGO_ProbeNameMappings_size * sizeof(char const *));
+
+    PGO_ProbeNameIndex_size = PGO_ProbeNameMappings_size * 2;
+    PGO_ProbeNameIndex = (uint32_t *)calloc(PGO_ProbeNameIndex_size, sizeof(uint32_t));
+
+    if (unlikely(PGO_ProbeNameMappings == NULL || PGO_ProbeNameIndex == NULL)) {
+        fprintf(stderr, "Error, failed to allocate PGO strings.\n");
+        exit(27);
+    }
+}
+
+static void PGO_writeTypeTraces(void);
+
+// Record the order modules were loaded in, as seen in "sys.modules", which
+// also covers extension modules not loaded by us.
+static void PGO_writeModuleLoadOrder(void) {
+    PyObject *modules = Nuitka_GetSysModules();
+
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+
+    while (Nuitka_DictNext(modules, &pos, &key, &value)) {
+        if (unlikely(!Nuitka_String_CheckExact(key))) {
+            continue;
+        }
+
+        // The module names may be released before the strings get written,
+        // keep a copy of them.
+        PGO_onProbePassed("ModuleLoaded", strdup(Nuitka_String_AsString(key)), 0);
+    }
 }
 
 void PGO_Finalize(void) {
+    PGO_writeModuleLoadOrder();
+    PGO_writeTypeTraces();
+
     PGO_writeString("END");
 
+    PGO_flushOutput();
+
     uint32_t offset = (uint32_t)ftell(pgo_output);
 
     for (uint32_t i = 0; i < PGO_ProbeNameMappings_used; i++) {
-        fputs(PGO_ProbeNameMappings[i], pgo_output);
-        fputc(0, pgo_output);
+        PGO_writeOutput(PGO_ProbeNameMappings[i], strlen(PGO_ProbeNameMappings[i]) + 1);
     }
 
-    fwrite(&PGO_ProbeNameMappings_used, sizeof(PGO_ProbeNameMappings_used), 1, pgo_output);
-    fwrite(&offset, sizeof(offset), 1, pgo_output);
+    PGO_writeOutput(&PGO_ProbeNameMappings_used, sizeof(PGO_ProbeNameMappings_used));
+    PGO_writeOutput(&offset, sizeof(offset));
 
-    fputs("YAK.PGO", pgo_output);
+    PGO_writeOutput("YAK.PGO", 7);
+
+    PGO_flushOutput();
     fclose(pgo_output);
 }
 
@@ -87,13 +217,143 @@ void PGO_onProbePassed(char const *probe_str, char const *module_name, uint32_t
     PGO_writeString(probe_str);
     PGO_writeString(module_name);
     // TODO: Variable args depending on probe type?
-    fwrite(&probe_arg, sizeof(probe_arg), 1, pgo_output);
+    PGO_writeOutput(&probe_arg, sizeof(probe_arg));
 }
 
 void PGO_onModuleEntered(char const *module_name) { PGO_onProbePassed("ModuleEnter", module_name, 0); }
 void PGO_onModuleExit(char const *module_name, bool error) { PGO_onProbePassed("ModuleExit", module_name, error); }
 void PGO_onTechnicalModule(char const *module_name) { PGO_onProbePassed("ModuleTechnical", module_name, 0); }
 
+// Type traces are aggregated in memory, per site and operand types, and only
+// written at the end, as these are passed far too often to write each.
+struct PGO_TypeTraceEntry {
+    char const *module_name;
+    char const *site_name;
+
+    PyTypeObject *type1;
+    PyTypeObject *type2;
+
+    char const *type1_name;
+    char const *type2_name;
+
+    uint32_t count;
+};
+
+static struct PGO_TypeTraceEntry *PGO_TypeTraces = NULL;
+static uint32_t PGO_TypeTraces_size = 0;
+static uint32_t PGO_TypeTraces_used = 0;
+
+static uint32_t PGO_hashTypeTrace(char const *site_name, PyTypeObject *type1, PyTypeObject *type2) {
+    uintptr_t hash = (uintptr_t)site_name;
+
+    hash = hash * 31 + (uintptr_t)type1;
+    hash = hash * 31 + (uintptr_t)type2;
+
+    return (uint32_t)(hash ^ (hash >> 16) ^ ((uint64_t)hash >> 32));
+}
+
+static char const *PGO_getTypeName(PyTypeObject *type) {
+    if (type == NULL) {
+        return "";
+    }
+
+    // Heap types may be released before the traces get written, keep a copy
+    // of their name then.
+    if (type->tp_flags & Py_TPFLAGS_HEAPTYPE) {
+        return strdup(type->tp_name);
+    } else {
+        return type->tp_name;
+    }
+}
+
+static struct PGO_TypeTraceEntry *PGO_findTypeTraceSlot(char const *module_name, char const *site_name,
+                                                        PyTypeObject *type1, PyTypeObject *type2) {
+    uint32_t mask = PGO_TypeTraces_size - 1;
+    uint32_t index = PGO_hashTypeTrace(site_name, type1, type2) & mask;
+
+    for (;;) {
+        struct PGO_TypeTraceEntry *entry = &PGO_TypeTraces[index];
+
+        if (entry->site_name == NULL) {
+            return entry;
+        }
+
+        if (entry->site_name == site_name && entry->module_name == module_name && entry->type1 == type1 &&
+            entry->type2 == type2) {
+            return entry;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static void PGO_growTypeTraces(void) {
+    struct PGO_TypeTraceEntry *old_traces = PGO_TypeTraces;
+    uint32_t old_size = PGO_TypeTraces_size;
+
+    PGO_TypeTraces_size = old_size == 0 ? 1024 : old_size * 2;
+    PGO_TypeTraces = (struct PGO_TypeTraceEntry *)calloc(PGO_TypeTraces_size, sizeof(struct PGO_TypeTraceEntry));
+
+    if (unlikely(PGO_TypeTraces == NULL)) {
+        NUITKA_CANNOT_GET_HERE("Out of memory for PGO type traces");
+    }
+
+    for (uint32_t i = 0; i < old_size; i++) {
+        struct PGO_TypeTraceEntry *old_entry = &old_traces[i];
+
+        if (old_entry->site_name != NULL) {
+            *PGO_findTypeTraceSlot(old_entry->module_name, old_entry->site_name, old_entry->type1, old_entry->type2) =
+                *old_entry;
+        }
+    }
+
+    free(old_traces);
+}
+
+void PGO_onTypeTraced(char const *module_name, char const *site_name, PyObject *operand1, PyObject *operand2) {
+    // Keep the load factor at most a half.
+    if (unlikely(PGO_TypeTraces_used * 2 >= PGO_TypeTraces_size)) {
+        PGO_growTypeTraces();
+    }
+
+    PyTypeObject *type1 = Py_TYPE(operand1);
+    PyTypeObject *type2 = operand2 != NULL ? Py_TYPE(operand2) : NULL;
+
+    struct PGO_TypeTraceEntry *entry = PGO_findTypeTraceSlot(module_name, site_name, type1, type2);
+
+    if (entry->site_name == NULL) {
+        entry->module_name = module_name;
+        entry->site_name = site_name;
+        entry->type1 = type1;
+        entry->type2 = type2;
+        entry->type1_name = PGO_getTypeName(type1);
+        entry->type2_name = PGO_getTypeName(type2);
+
+        PGO_TypeTraces_used += 1;
+    }
+
+    if (likely(entry->count < INT32_MAX)) {
+        entry->count += 1;
+    }
+}
+
+static void PGO_writeTypeTraces(void) {
+    for (uint32_t i = 0; i < PGO_TypeTraces_size; i++) {
+        struct PGO_TypeTraceEntry *entry = &PGO_TypeTraces[i];
+
+        if (entry->site_name == NULL) {
+            continue;
+        }
+
+        PGO_writeString("TypeTrace");
+        PGO_writeString(entry->module_name);
+        PGO_writeString(entry->site_name);
+        PGO_writeString(entry->type1_name);
+        PGO_writeString(entry->type2_name);
+        PGO_writeOutput(&entry->count, sizeof(entry->count));
+    }
+}
+
 //     Part of "Nuitka", an optimizing Python compiler that is compatible and
 //     integrates with CPython, but also works on its own.
 //
@@ -762,6 +762,87 @@ bool UNICODE_APPEND(PyThreadState *tstate, PyObject **p_left, PyObject *right) {
 
     return true;
 }
+
+PyObject *UNICODE_JOIN_ARRAY(PyThreadState *tstate, PyObject *const *items, Py_ssize_t count) {
+    Py_ssize_t total_length = 0;
+    Py_UCS4 max_char = 0;
+
+    // Single pass to check the items, and determine the result size and kind.
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject *item = items[i];
+        CHECK_OBJECT(item);
+
+        if (unlikely(!PyUnicode_Check(item))) {
+            PyErr_Format(PyExc_TypeError, "sequence item %zd: expected str instance, %s found", i,
+                         Py_TYPE(item)->tp_name);
+            return NULL;
+        }
+
+#if PYTHON_VERSION < 0x3c0
+        if (unlikely(PyUnicode_READY(item) == -1)) {
+            return NULL;
+        }
+#endif
+
+        Py_ssize_t item_length = PyUnicode_GET_LENGTH(item);
+
+        if (item_length == 0) {
+            continue;
+        }
+
+        if (unlikely(total_length > PY_SSIZE_T_MAX - item_length)) {
+            SET_CURRENT_EXCEPTION_TYPE0_STR(tstate, PyExc_OverflowError, "join() result is too long for a Python string");
+            return NULL;
+        }
+
+        total_length += item_length;
+        max_char = Py_MAX(max_char, PyUnicode_MAX_CHAR_VALUE(item));
+    }
+
+    if (total_length == 0) {
+        Py_INCREF(const_str_empty);
+        return const_str_empty;
+    }
+
+    // Like "str.join" does, a single exact value is its own result.
+    if (count == 1 && PyUnicode_CheckExact(items[0])) {
+        Py_INCREF(items[0]);
+        return items[0];
+    }
+
+    PyObject *result = PyUnicode_New(total_length, max_char);
+
+    if (unlikely(result == NULL)) {
+        return NULL;
+    }
+
+    unsigned int result_kind = PyUnicode_KIND(result);
+    char *result_data = (char *)PyUnicode_DATA(result);
+
+    Py_ssize_t position = 0;
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject *item = items[i];
+        Py_ssize_t item_length = PyUnicode_GET_LENGTH(item);
+
+        if (item_length == 0) {
+            continue;
+        }
+
+        // Values of the widest kind, mostly all of them, are copied as a whole.
+        if (PyUnicode_KIND(item) == result_kind) {
+            memcpy(result_data + result_kind * position, PyUnicode_DATA(item), result_kind * item_length);
+        } else {
+            _NuitkaUnicode_FastCopyCharacters(result, position, item, 0, item_length);
+        }
+
+        position += item_length;
+    }
+
+    assert(position == total_length);
+
+    return result;
+}
 #endif
 
 PyObject *UNICODE_JOIN(PyThreadState *tstate, PyObject *str, PyObject *iterable) {
@@ -358,8 +358,10 @@ void patchTypeComparison(void) {
 #include "nuitka/freelists.h"
 
 #define MAX_TRACEBACK_FREE_LIST_COUNT 1000
+#ifndef Py_GIL_DISABLED
 static PyTracebackObject *free_list_tracebacks = NULL;
 static int free_list_tracebacks_count = 0;
+#endif
 
 // Create a traceback for a given frame, using a free list hacked into the
 // existing type.
@@ -1624,6 +1624,11 @@ orig_argv = argv;
     startProfiling();
 #endif
 
+#if _NUITKA_PROFILE_SAMPLING
+    // Profiling with our own sampling profiler if enabled.
+    startSamplingProfiler();
+#endif
+
 #if _NUITKA_PGO_PYTHON
     // Profiling with our own Python PGO if enabled.
     PGO_Initialize();
@@ -1770,6 +1775,10 @@ orig_argv = argv;
     stopProfiling();
 #endif
 
+#if _NUITKA_PROFILE_SAMPLING
+    stopSamplingProfiler();
+#endif
+
 #if _NUITKA_PGO_PYTHON
     // Write out profiling with our own Python PGO if enabled.
     PGO_Finalize();
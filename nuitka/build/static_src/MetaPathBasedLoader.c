@@ -50,6 +50,8 @@ static inline bool isVerbose(void) { return false; }
 #endif
 
 static struct Nuitka_MetaPathBasedLoaderEntry *loader_entries = NULL;
+static int *loader_entries_index = NULL;
+static int loader_entries_index_size = 0;
 
 static bool hasFrozenModule(char const *name) {
     for (struct _frozen const *p = PyImport_FrozenModules; p != NULL; p++) {
@@ -246,54 +248,55 @@ static PyObject *loadModuleFromCodeObject(PyThreadState *tstate, PyObject *modul
     return module;
 }
 
-static struct Nuitka_MetaPathBasedLoaderEntry *findEntry(char const *name) {
-    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
-    assert(current);
+static inline void unTranslateEntryName(struct Nuitka_MetaPathBasedLoaderEntry *entry) {
+    if ((entry->flags & NUITKA_TRANSLATED_FLAG) != 0) {
+        entry->name = UN_TRANSLATE(entry->name);
+        entry->flags -= NUITKA_TRANSLATED_FLAG;
+    }
+}
 
-    while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UN_TRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
+// Find the loader entry with a name given with length, using the hash index
+// created at compile time, so this does not depend on the number of entries.
+static struct Nuitka_MetaPathBasedLoaderEntry *findEntryN(char const *name, size_t length, bool package_only) {
+    assert(loader_entries);
+    assert(loader_entries_index);
+
+    uint32_t mask = (uint32_t)(loader_entries_index_size - 1);
+    uint32_t slot = Nuitka_HashModuleName(name, length) & mask;
+
+    for (;;) {
+        int index = loader_entries_index[slot];
+
+        if (index < 0) {
+            return NULL;
         }
 
-        if (strcmp(name, current->name) == 0) {
-            return current;
+        struct Nuitka_MetaPathBasedLoaderEntry *current = &loader_entries[index];
+        unTranslateEntryName(current);
+
+        if (package_only == false || (current->flags & NUITKA_PACKAGE_FLAG) != 0) {
+            if (strncmp(name, current->name, length) == 0 && current->name[length] == 0) {
+                return current;
+            }
         }
 
-        current++;
+        slot = (slot + 1) & mask;
     }
+}
 
-    return NULL;
+static struct Nuitka_MetaPathBasedLoaderEntry *findEntry(char const *name) {
+    return findEntryN(name, strlen(name), false);
 }
 
 #ifndef _NUITKA_STANDALONE
 static struct Nuitka_MetaPathBasedLoaderEntry *findContainingPackageEntry(char const *name) {
-    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
-
     // Consider the package name of the searched entry.
     char const *package_name_end = strrchr(name, '.');
     if (package_name_end == NULL) {
         return NULL;
     }
 
-    size_t length = package_name_end - name;
-
-    while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UN_TRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
-        }
-
-        if ((current->flags & NUITKA_PACKAGE_FLAG) != 0) {
-            if (strlen(current->name) == length && strncmp(name, current->name, length) == 0) {
-                return current;
-            }
-        }
-
-        current++;
-    }
-
-    return NULL;
+    return findEntryN(name, package_name_end - name, true);
 }
 
 static PyObject *_getFileList(PyThreadState *tstate, PyObject *dirname) {
@@ -570,6 +573,176 @@ static PyObject *_nuitka_loader_find_module(PyObject *self, PyObject *args, PyOb
     return Py_None;
 }
 
+static struct Nuitka_EmbeddedDataFileEntry const *embedded_data_file_entries = NULL;
+static char **embedded_data_file_data = NULL;
+
+// Full paths of the embedded data files, to their entries, and of the
+// directories containing them, to the names inside of them. Created on first
+// use, as only then the binary directory is known.
+static PyObject *embedded_data_files_dict = NULL;
+static PyObject *embedded_data_directories_dict = NULL;
+
+void registerEmbeddedDataFiles(struct Nuitka_EmbeddedDataFileEntry const *data_file_entries,
+                               unsigned char **bytecode_data) {
+    embedded_data_file_entries = data_file_entries;
+    embedded_data_file_data = (char **)bytecode_data;
+}
+
+static bool _addEmbeddedDataDirectoryEntry(PyThreadState *tstate, PyObject *directories_dict, PyObject *directory,
+                                           PyObject *name) {
+    PyObject *names = DICT_GET_ITEM0(tstate, directories_dict, directory);
+
+    if (names == NULL) {
+        names = MAKE_DICT_EMPTY(tstate);
+
+        bool res = DICT_SET_ITEM(directories_dict, directory, names);
+        Py_DECREF(names);
+
+        if (unlikely(res == false)) {
+            return false;
+        }
+    }
+
+    return DICT_SET_ITEM(names, name, Py_True);
+}
+
+static bool _addEmbeddedDataFile(PyThreadState *tstate, PyObject *files_dict, PyObject *directories_dict,
+                                 struct Nuitka_EmbeddedDataFileEntry const *data_file) {
+    PyObject *name = Nuitka_String_FromString(data_file->name);
+
+    if (unlikely(name == NULL)) {
+        return false;
+    }
+
+    PyObject *path = MAKE_RELATIVE_PATH(name);
+    Py_DECREF(name);
+
+    if (unlikely(path == NULL)) {
+        return false;
+    }
+
+    PyObject *entry = PyLong_FromVoidPtr((void *)data_file);
+
+    if (unlikely(entry == NULL)) {
+        Py_DECREF(path);
+        return false;
+    }
+
+    bool res = DICT_SET_ITEM(files_dict, path, entry);
+    Py_DECREF(entry);
+
+    // Make the containing directories known, up to the binary directory,
+    // with their contents.
+    for (char const *c = data_file->name; res && c != NULL; c = strchr(c + 1, SEP)) {
+        PyObject *directory = OS_PATH_DIRNAME(tstate, path);
+
+        if (unlikely(directory == NULL)) {
+            res = false;
+            break;
+        }
+
+        PyObject *basename = OS_PATH_BASENAME(tstate, path);
+
+        if (unlikely(basename == NULL)) {
+            Py_DECREF(directory);
+
+            res = false;
+            break;
+        }
+
+        res = _addEmbeddedDataDirectoryEntry(tstate, directories_dict, directory, basename);
+
+        Py_DECREF(basename);
+        Py_DECREF(path);
+
+        path = directory;
+    }
+
+    Py_DECREF(path);
+
+    return res;
+}
+
+static bool _initEmbeddedDataFiles(PyThreadState *tstate) {
+    if (embedded_data_file_entries == NULL || embedded_data_file_entries->name == NULL) {
+        return false;
+    }
+
+    if (embedded_data_files_dict != NULL) {
+        return true;
+    }
+
+    PyObject *files_dict = MAKE_DICT_EMPTY(tstate);
+    PyObject *directories_dict = MAKE_DICT_EMPTY(tstate);
+
+    for (struct Nuitka_EmbeddedDataFileEntry const *current = embedded_data_file_entries; current->name != NULL;
+         current++) {
+        if (unlikely(_addEmbeddedDataFile(tstate, files_dict, directories_dict, current) == false)) {
+            Py_DECREF(files_dict);
+            Py_DECREF(directories_dict);
+
+            // Callers only ask if a file is embedded, and do not expect an
+            // exception, report it here, and try again next time.
+            PyErr_WriteUnraisable(NULL);
+
+            return false;
+        }
+    }
+
+    embedded_data_files_dict = files_dict;
+    embedded_data_directories_dict = directories_dict;
+
+    return true;
+}
+
+struct Nuitka_EmbeddedDataFileEntry const *findEmbeddedDataFile(PyThreadState *tstate, PyObject *filename) {
+    // Only exact strings, others could have their own ideas of equality.
+    if (!Nuitka_String_CheckExact(filename)) {
+        return NULL;
+    }
+
+    if (_initEmbeddedDataFiles(tstate) == false) {
+        return NULL;
+    }
+
+    PyObject *entry = DICT_GET_ITEM0(tstate, embedded_data_files_dict, filename);
+
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    return (struct Nuitka_EmbeddedDataFileEntry const *)PyLong_AsVoidPtr(entry);
+}
+
+// A new copy each time, not kept, so the memory is only used while needed.
+PyObject *getEmbeddedDataFileBytes(struct Nuitka_EmbeddedDataFileEntry const *data_file) {
+    return Nuitka_Bytes_FromStringAndSize(embedded_data_file_data[data_file->data_index], data_file->data_size);
+}
+
+#if PYTHON_VERSION >= 0x300
+PyObject *getEmbeddedDataFileMemoryView(struct Nuitka_EmbeddedDataFileEntry const *data_file) {
+    return PyMemoryView_FromMemory(embedded_data_file_data[data_file->data_index], data_file->data_size, PyBUF_READ);
+}
+#endif
+
+PyObject *getEmbeddedDataDirectoryNames(PyThreadState *tstate, PyObject *path) {
+    if (!Nuitka_String_CheckExact(path)) {
+        return NULL;
+    }
+
+    if (_initEmbeddedDataFiles(tstate) == false) {
+        return NULL;
+    }
+
+    PyObject *names = DICT_GET_ITEM0(tstate, embedded_data_directories_dict, path);
+
+    if (names == NULL) {
+        return NULL;
+    }
+
+    return PyDict_Keys(names);
+}
+
 static char const *_kw_list_get_data[] = {"filename", NULL};
 
 static PyObject *_nuitka_loader_get_data(PyObject *self, PyObject *args, PyObject *kwds) {
@@ -678,7 +851,117 @@ static void _makeModuleCFilenameValue(filename_char_t *filename, size_t filename
     appendStringSafe(filename, ".so", filename_size);
 #endif
 }
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// Filenames of extension modules to read ahead, ending with an empty one, these
+// are owned by the prefetch thread once started.
+typedef filename_char_t prefetch_filename_t[MAXPATHLEN + 1];
+static prefetch_filename_t *prefetch_filenames = NULL;
+
+// Read the files in the background, such that loading them later finds them
+// in the OS disk cache already.
+#ifdef _WIN32
+static DWORD WINAPI prefetchExtensionModulesThread(LPVOID arg) {
+#else
+static void *prefetchExtensionModulesThread(void *arg) {
 #endif
+    static char buffer[64 * 1024];
+
+    for (prefetch_filename_t *current = prefetch_filenames; (*current)[0] != 0; current++) {
+#ifdef _WIN32
+        HANDLE file_handle = CreateFileW(*current, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                         FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            continue;
+        }
+
+        DWORD read_size;
+        while (ReadFile(file_handle, buffer, sizeof(buffer), &read_size, NULL) && read_size > 0) {
+        }
+
+        CloseHandle(file_handle);
+#else
+        int fd = open(*current, O_RDONLY);
+
+        if (fd == -1) {
+            continue;
+        }
+
+        while (read(fd, buffer, sizeof(buffer)) > 0) {
+        }
+
+        close(fd);
+#endif
+    }
+
+    free(prefetch_filenames);
+    prefetch_filenames = NULL;
+
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+#endif
+
+void prefetchExtensionModules(PyThreadState *tstate, int const *prefetch_indexes) {
+#ifdef _NUITKA_STANDALONE
+    int count = 0;
+    while (prefetch_indexes[count] != -1) {
+        count += 1;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    prefetch_filenames = (prefetch_filename_t *)calloc(count + 1, sizeof(prefetch_filename_t));
+
+    if (unlikely(prefetch_filenames == NULL)) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        struct Nuitka_MetaPathBasedLoaderEntry const *entry = &loader_entries[prefetch_indexes[i]];
+        assert((entry->flags & NUITKA_EXTENSION_MODULE_FLAG) != 0);
+
+        PyObject *module_name = Nuitka_String_FromString(entry->name);
+        _makeModuleCFilenameValue(prefetch_filenames[i], MAXPATHLEN + 1, entry->name, module_name,
+                                  (entry->flags & NUITKA_PACKAGE_FLAG) != 0);
+        Py_DECREF(module_name);
+    }
+
+    if (isVerbose()) {
+        PySys_WriteStderr("Prefetching %d extension modules in the background.\n", count);
+    }
+
+#ifdef _WIN32
+    HANDLE thread_handle = CreateThread(NULL, 0, prefetchExtensionModulesThread, NULL, 0, NULL);
+
+    if (thread_handle != NULL) {
+        CloseHandle(thread_handle);
+        return;
+    }
+#else
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, prefetchExtensionModulesThread, NULL) == 0) {
+        pthread_detach(thread);
+        return;
+    }
+#endif
+
+    free(prefetch_filenames);
+    prefetch_filenames = NULL;
+#endif
+}
 
 #if PYTHON_VERSION >= 0x3c0 && defined(_NUITKA_USE_UNEXPOSED_API)
 extern _Thread_local const char *pkgcontext;
@@ -1318,10 +1601,7 @@ static PyObject *_nuitka_loader_iter_modules(struct Nuitka_LoaderObject *self, P
     }
 
     while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UN_TRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+        unTranslateEntryName(current);
 
         int c = strncmp(s, current->name, strlen(s));
 
@@ -1806,10 +2086,7 @@ static PyObject *_nuitka_loader_sys_path_hook(PyObject *self, PyObject *args, Py
     PyThreadState *tstate = PyThreadState_GET();
 
     while (entry->name != NULL) {
-        if ((entry->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            entry->name = UN_TRANSLATE(entry->name);
-            entry->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+        unTranslateEntryName(entry);
 
         if ((entry->flags & NUITKA_PACKAGE_FLAG) != 0) {
             PyObject *module_directory = getModuleDirectory(tstate, entry);
@@ -1883,8 +2160,10 @@ static PyObject *Nuitka_Loader_tp_repr(struct Nuitka_LoaderObject *loader) {
 // use the free list mechanism at all.
 
 #define MAX_LOADER_FREE_LIST_COUNT 10
+#ifndef Py_GIL_DISABLED
 static struct Nuitka_LoaderObject *free_list_loaders = NULL;
 static int free_list_loaders_count = 0;
+#endif
 
 static void Nuitka_Loader_tp_dealloc(struct Nuitka_LoaderObject *loader) {
     Nuitka_GC_UnTrack(loader);
@@ -1963,6 +2242,27 @@ PyObject *Nuitka_Loader_New(struct Nuitka_MetaPathBasedLoaderEntry const *entry)
 }
 
 #ifdef _NUITKA_MODULE
+// The index from compile time is for the names without the module root, so
+// after changing these, it needs to be created again, keeping its size.
+static void rebuildLoaderEntriesIndex(void) {
+    uint32_t mask = (uint32_t)(loader_entries_index_size - 1);
+
+    for (int i = 0; i < loader_entries_index_size; i++) {
+        loader_entries_index[i] = -1;
+    }
+
+    for (int index = 0; loader_entries[index].name != NULL; index++) {
+        char const *name = loader_entries[index].name;
+        uint32_t slot = Nuitka_HashModuleName(name, strlen(name)) & mask;
+
+        while (loader_entries_index[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+
+        loader_entries_index[slot] = index;
+    }
+}
+
 void updateMetaPathBasedLoaderModuleRoot(char const *module_root_name) {
     assert(module_root_name != NULL);
     char const *last_dot = strrchr(module_root_name, '.');
@@ -1972,10 +2272,7 @@ void updateMetaPathBasedLoaderModuleRoot(char const *module_root_name) {
         assert(current);
 
         while (current->name != NULL) {
-            if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-                current->name = UN_TRANSLATE(current->name);
-                current->flags -= NUITKA_TRANSLATED_FLAG;
-            }
+            unTranslateEntryName(current);
 
             char name[2048];
 
@@ -1994,12 +2291,14 @@ void updateMetaPathBasedLoaderModuleRoot(char const *module_root_name) {
 
             current++;
         }
+
+        rebuildLoaderEntriesIndex();
     }
 }
 #endif
 
-void registerMetaPathBasedLoader(struct Nuitka_MetaPathBasedLoaderEntry *_loader_entries,
-                                 unsigned char **bytecode_data) {
+void registerMetaPathBasedLoader(struct Nuitka_MetaPathBasedLoaderEntry *_loader_entries, int *_loader_index,
+                                 int loader_index_size, unsigned char **bytecode_data) {
     // Do it only once.
     if (loader_entries) {
         assert(_loader_entries == loader_entries);
@@ -2014,6 +2313,11 @@ void registerMetaPathBasedLoader(struct Nuitka_MetaPathBasedLoaderEntry *_loader
     }
 
     loader_entries = _loader_entries;
+    loader_entries_index = _loader_index;
+    loader_entries_index_size = loader_index_size;
+
+    assert(loader_entries_index_size > 0);
+    assert((loader_entries_index_size & (loader_entries_index_size - 1)) == 0);
 
 #if defined(_NUITKA_MODULE) && PYTHON_VERSION < 0x3c0
     if (_Py_PackageContext != NULL) {
@@ -131,6 +131,8 @@ static PyObject *Nuitka_ResourceReaderFiles_iterdir(struct Nuitka_ResourceReader
         Py_DECREF(joined);
     }
 
+    Py_DECREF(file_names);
+
     PyObject *result = MAKE_ITERATOR_INFALLIBLE(files_objects);
     Py_DECREF(files_objects);
 
@@ -398,12 +400,59 @@ static PyObject *Nuitka_ResourceReaderFiles_open(struct Nuitka_ResourceReaderFil
 
     PyObject *file_name = _Nuitka_ResourceReaderFiles_GetPath(tstate, files);
 
-    return BUILTIN_OPEN(tstate, file_name, mode, buffering, encoding, errors, newline, NULL, NULL);
+    if (unlikely(file_name == NULL)) {
+        return NULL;
+    }
+
+    PyObject *result = BUILTIN_OPEN(tstate, file_name, mode, buffering, encoding, errors, newline, NULL, NULL);
+    Py_DECREF(file_name);
+
+    return result;
 }
 
+#if PYTHON_VERSION >= 0x390
+// The "importlib.resources.as_file" implementation we overload, it creates
+// temporary files from the contents.
+static PyObject *Nuitka_ResourceReaderFiles_default_as_file = NULL;
+#endif
+
 static PyObject *Nuitka_ResourceReaderFiles_as_file(struct Nuitka_ResourceReaderFilesObject *files) {
     CHECK_OBJECT(files);
 
+#if PYTHON_VERSION >= 0x390
+    if (Nuitka_ResourceReaderFiles_default_as_file != NULL) {
+        PyThreadState *tstate = PyThreadState_GET();
+
+        PyObject *file_name = _Nuitka_ResourceReaderFiles_GetPath(tstate, files);
+
+        if (unlikely(file_name == NULL)) {
+            return NULL;
+        }
+
+        // Embedded data files have no file name to give out, so they need a
+        // temporary file. Only newer Python can copy directories containing
+        // them to a temporary directory.
+        bool embedded = findEmbeddedDataFile(tstate, file_name) != NULL;
+
+#if PYTHON_VERSION >= 0x3c0
+        if (embedded == false) {
+            PyObject *embedded_names = getEmbeddedDataDirectoryNames(tstate, file_name);
+
+            if (embedded_names != NULL) {
+                Py_DECREF(embedded_names);
+                embedded = true;
+            }
+        }
+#endif
+
+        Py_DECREF(file_name);
+
+        if (embedded) {
+            return CALL_FUNCTION_WITH_SINGLE_ARG(tstate, Nuitka_ResourceReaderFiles_default_as_file, (PyObject *)files);
+        }
+    }
+#endif
+
     Py_INCREF(files);
     return (PyObject *)files;
 }
@@ -702,6 +751,12 @@ static void registerResourceReaderFiles(PyThreadState *tstate, PyObject *resourc
             LOOKUP_ATTRIBUTE(tstate, (PyObject *)&Nuitka_ResourceReaderFiles_Type, const_str_plain_as_file);
         CHECK_OBJECT(our_as_file);
 
+        Nuitka_ResourceReaderFiles_default_as_file =
+            CALL_METHOD_WITH_SINGLE_ARG(tstate, as_file, const_str_plain_dispatch, (PyObject *)&PyBaseObject_Type);
+        if (unlikely(Nuitka_ResourceReaderFiles_default_as_file == NULL)) {
+            CLEAR_ERROR_OCCURRED(tstate);
+        }
+
         PyObject *args[2] = {(PyObject *)&Nuitka_ResourceReaderFiles_Type, our_as_file};
 
         PyObject *register_result = CALL_METHOD_WITH_ARGS2(tstate, as_file, const_str_plain_register, args);
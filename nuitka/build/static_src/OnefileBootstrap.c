@@ -60,6 +60,7 @@
 #define _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
 #define _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_HANDLING
 #define _NUITKA_ONEFILE_TEMP_BOOL 0
+#define _NUITKA_ONEFILE_FULL_VERIFY_BOOL 0
 #define _NUITKA_ONEFILE_CHILD_GRACE_TIME_INT 5000
 #define _NUITKA_ONEFILE_TEMP_SPEC "{TEMP}/onefile_{PID}_{TIME}"
 
@@ -135,7 +136,8 @@ static void fatalErrorAttachedData(void) { fatalError("Error, couldn't decode at
 static void fatalErrorHeaderAttachedData(void) { fatalError("Error, couldn't find attached data header."); }
 
 // Out of memory error.
-#if !defined(_WIN32) || _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#if !defined(_WIN32) || _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 || _NUITKA_ONEFILE_TEMP_BOOL == 0 ||                     \
+    _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
 static void fatalErrorMemory(void) { fatalError("Error, couldn't allocate memory."); }
 #endif
 
@@ -223,7 +225,7 @@ static void closePayloadData(void) { unmapFileFromMemory(&exe_file_mapped); }
 
 #endif
 
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
 
 static ZSTD_DCtx *dest_ctx = NULL;
 static ZSTD_inBuffer input = {NULL, 0, 0};
@@ -377,85 +379,589 @@ static filename_char_t *readPayloadFilename(void) {
     return buffer;
 }
 
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
 static void writeContainedFile(FILE_HANDLE target_file, unsigned long long file_size) {
+    while (file_size > 0) {
+        static char chunk[32768];
+
+        long chunk_size;
+
+        // Doing min manually, as otherwise the compiler is confused from types.
+        if (file_size <= sizeof(chunk)) {
+            chunk_size = (long)file_size;
+        } else {
+            chunk_size = sizeof(chunk);
+        }
+
+        readPayloadChunk(chunk, chunk_size);
+
+        if (target_file != FILE_HANDLE_NULL) {
+            if (writeFileChunk(target_file, chunk, chunk_size) == false) {
+                fatalErrorTempFiles();
+            }
+        }
+
+        file_size -= chunk_size;
+    }
+
+    assert(file_size == 0);
+}
+#endif
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+static void makeFileExecutable(FILE_HANDLE target_file) {
+    int fd = fileno(target_file);
+
+    struct stat stat_buffer;
+    int res = fstat(fd, &stat_buffer);
+
+    if (res == -1) {
+        printOSErrorMessage("fstat", errno);
+    }
+
+    // User shall be able to execute if at least.
+    stat_buffer.st_mode |= S_IXUSR;
+
+    // Follow read flags for group, others according to umask.
+    if ((stat_buffer.st_mode & S_IRGRP) != 0) {
+        stat_buffer.st_mode |= S_IXOTH;
+    }
+
+    if ((stat_buffer.st_mode & S_IRGRP) != 0) {
+        stat_buffer.st_mode |= S_IXOTH;
+    }
+
+    res = fchmod(fd, stat_buffer.st_mode);
+
+    if (res == -1) {
+        printOSErrorMessage("fchmod", errno);
+    }
+}
+#endif
+
+// Zero means, not yet created, created unsuccessfully, terminated already.
+#if defined(_WIN32)
+HANDLE handle_process = 0;
+#else
+pid_t handle_process = 0;
+#endif
+
+static filename_char_t payload_path[4096] = {0};
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 1
+static bool payload_created = false;
+#endif
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+
+// For cached mode, a manifest of the extracted files is written after a
+// successful unpacking. It is identified by the checksum of the payload, and
+// has a record for every file, so a launch of the same payload can verify the
+// files by their status only, instead of reading all of their contents.
+#define ONEFILE_MANIFEST_FILENAME FILENAME_EMPTY_STR "__nuitka_onefile_manifest.bin"
+#define ONEFILE_MANIFEST_MAGIC "KAM1"
+
+struct ManifestFileInfo {
+    uint64_t file_size;
+    int64_t mtime;
+    int64_t ctime;
+    uint64_t inode;
+};
+
+struct ManifestHeader {
+    char magic[4];
+    uint32_t payload_checksum;
+    uint64_t payload_size;
+    uint32_t entry_count;
+};
+
+static bool getManifestFileInfo(filename_char_t const *path, struct ManifestFileInfo *info) {
+    memset(info, 0, sizeof(*info));
+
+#if defined(_WIN32)
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+    if (GetFileAttributesExW(path, GetFileExInfoStandard, &attributes) == 0) {
+        return false;
+    }
+
+    info->file_size = ((uint64_t)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+    info->mtime = (int64_t)(((uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32) |
+                            attributes.ftLastWriteTime.dwLowDateTime);
+    info->ctime = (int64_t)(((uint64_t)attributes.ftCreationTime.dwHighDateTime << 32) |
+                            attributes.ftCreationTime.dwLowDateTime);
+#else
+    struct stat stat_buffer;
+
+    // Symbolic links are recorded as themselves, not their targets.
+    if (lstat(path, &stat_buffer) != 0) {
+        return false;
+    }
+
+    info->file_size = (uint64_t)stat_buffer.st_size;
+    info->mtime = (int64_t)stat_buffer.st_mtime;
+    info->ctime = (int64_t)stat_buffer.st_ctime;
+    info->inode = (uint64_t)stat_buffer.st_ino;
+#endif
+
+    return true;
+}
+
+static void getManifestPath(filename_char_t *buffer, size_t buffer_size) {
+    buffer[0] = 0;
+
+    appendStringSafeFilename(buffer, payload_path, buffer_size);
+    appendCharSafeFilename(buffer, FILENAME_SEP_CHAR, buffer_size);
+    appendStringSafeFilename(buffer, ONEFILE_MANIFEST_FILENAME, buffer_size);
+}
+
+// Manifest contents collected during unpacking, written at the end.
+static unsigned char *manifest_buffer = NULL;
+static size_t manifest_buffer_used = 0;
+static size_t manifest_buffer_size = 0;
+static uint32_t manifest_entry_count = 0;
+
+static void appendManifestData(void const *data, size_t size) {
+    if (manifest_buffer_used + size > manifest_buffer_size) {
+        while (manifest_buffer_used + size > manifest_buffer_size) {
+            manifest_buffer_size = manifest_buffer_size ? manifest_buffer_size * 2 : 65536;
+        }
+
+        manifest_buffer = (unsigned char *)realloc(manifest_buffer, manifest_buffer_size);
+
+        if (manifest_buffer == NULL) {
+            fatalErrorMemory();
+        }
+    }
+
+    memcpy(manifest_buffer + manifest_buffer_used, data, size);
+    manifest_buffer_used += size;
+}
+
+static void addManifestEntry(filename_char_t const *target_path) {
+    // Only the name relative to the payload path is recorded.
+    filename_char_t const *filename = target_path + strlenFilename(payload_path) + 1;
+
+    struct ManifestFileInfo info;
+
+    if (getManifestFileInfo(target_path, &info) == false) {
+        fatalErrorTempFileCreate(target_path);
+    }
+
+    appendManifestData(&info, sizeof(info));
+
+    uint32_t filename_length = (uint32_t)(strlenFilename(filename) + 1);
+    appendManifestData(&filename_length, sizeof(filename_length));
+    appendManifestData(filename, filename_length * sizeof(filename_char_t));
+
+    manifest_entry_count += 1;
+}
+
+static void writeManifest(uint32_t payload_checksum) {
+    filename_char_t manifest_path[4096];
+    getManifestPath(manifest_path, sizeof(manifest_path) / sizeof(filename_char_t));
+
+    // Write to a temporary file and rename it, so a manifest, if present at
+    // all, is always complete.
+    filename_char_t manifest_path_tmp[4096];
+    manifest_path_tmp[0] = 0;
+    appendStringSafeFilename(manifest_path_tmp, manifest_path, sizeof(manifest_path_tmp) / sizeof(filename_char_t));
+    appendStringSafeFilename(manifest_path_tmp, FILENAME_TMP_STR, sizeof(manifest_path_tmp) / sizeof(filename_char_t));
+
+    struct ManifestHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ONEFILE_MANIFEST_MAGIC, sizeof(header.magic));
+    header.payload_checksum = payload_checksum;
+    header.payload_size = payload_size;
+    header.entry_count = manifest_entry_count;
+
+    FILE_HANDLE manifest_file = createFileForWritingChecked(manifest_path_tmp);
+
+    if (writeFileChunk(manifest_file, &header, sizeof(header)) == false ||
+        writeFileChunk(manifest_file, manifest_buffer, manifest_buffer_used) == false) {
+        fatalErrorTempFiles();
+    }
+
+    if (closeFile(manifest_file) == false) {
+        fatalErrorTempFiles();
+    }
+
+    if (renameFile(manifest_path_tmp, manifest_path) == false) {
+        fatalErrorTempFiles();
+    }
+
+    free(manifest_buffer);
+    manifest_buffer = NULL;
+}
+
+static void removeManifest(void) {
+    filename_char_t manifest_path[4096];
+    getManifestPath(manifest_path, sizeof(manifest_path) / sizeof(filename_char_t));
+
+    deleteFile(manifest_path);
+}
+
+// Check if a manifest for this payload exists and all files in it are
+// unchanged, then the unpacking can be skipped entirely. The first file is
+// the binary to run, and provided via "first_filename".
+static bool checkManifest(uint32_t payload_checksum, filename_char_t *first_filename, size_t first_filename_size) {
+    filename_char_t manifest_path[4096];
+    getManifestPath(manifest_path, sizeof(manifest_path) / sizeof(filename_char_t));
+
+    struct MapFileToMemoryInfo mapped_manifest = mapFileToMemory(manifest_path);
+
+    if (mapped_manifest.error) {
+        return false;
+    }
+
+    unsigned char const *current = mapped_manifest.data;
+    unsigned char const *end = mapped_manifest.data + mapped_manifest.file_size;
+
+    bool result = false;
+
+    struct ManifestHeader header;
+
+    if (end - current < (ptrdiff_t)sizeof(header)) {
+        goto finish;
+    }
+
+    memcpy(&header, current, sizeof(header));
+    current += sizeof(header);
+
+    if (memcmp(header.magic, ONEFILE_MANIFEST_MAGIC, sizeof(header.magic)) != 0 ||
+        header.payload_checksum != payload_checksum || header.payload_size != payload_size ||
+        header.entry_count == 0) {
+        goto finish;
+    }
+
+    for (uint32_t i = 0; i < header.entry_count; i++) {
+        struct ManifestFileInfo recorded_info;
+        uint32_t filename_length;
+
+        if (end - current < (ptrdiff_t)(sizeof(recorded_info) + sizeof(filename_length))) {
+            goto finish;
+        }
+
+        memcpy(&recorded_info, current, sizeof(recorded_info));
+        current += sizeof(recorded_info);
+        memcpy(&filename_length, current, sizeof(filename_length));
+        current += sizeof(filename_length);
+
+        if (filename_length == 0 || filename_length > 1024 ||
+            end - current < (ptrdiff_t)(filename_length * sizeof(filename_char_t))) {
+            goto finish;
+        }
+
+        filename_char_t filename[1024];
+        memcpy(filename, current, filename_length * sizeof(filename_char_t));
+        current += filename_length * sizeof(filename_char_t);
+
+        if (filename[filename_length - 1] != 0) {
+            goto finish;
+        }
+
+        filename_char_t target_path[4096];
+        target_path[0] = 0;
+        appendStringSafeFilename(target_path, payload_path, sizeof(target_path) / sizeof(filename_char_t));
+        appendCharSafeFilename(target_path, FILENAME_SEP_CHAR, sizeof(target_path) / sizeof(filename_char_t));
+        appendStringSafeFilename(target_path, filename, sizeof(target_path) / sizeof(filename_char_t));
+
+        struct ManifestFileInfo existing_info;
+        if (getManifestFileInfo(target_path, &existing_info) == false ||
+            memcmp(&existing_info, &recorded_info, sizeof(existing_info)) != 0) {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+            fprintf(stderr, "MANIFEST MISMATCH for '" FILENAME_FORMAT_STR "'.\n", target_path);
+#endif
+            goto finish;
+        }
+
+        if (i == 0) {
+            first_filename[0] = 0;
+            appendStringSafeFilename(first_filename, target_path, first_filename_size);
+        }
+    }
+
+    result = current == end;
+
+finish:
+    unmapFileFromMemory(&mapped_manifest);
+
+    return result;
+}
+
+#endif
+
 #if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
 
+// In archive mode, every file is stored on its own, as a separate zstd frame
+// if compressed. The payload is scanned for the files first, which is cheap,
+// and then they are written by a pool of worker threads.
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#define MAX_ARCHIVE_WORKERS 64
+
+struct PayloadArchiveEntry {
+    filename_char_t *target_path;
+
+    // Stored data, compressed if compression is used.
+    unsigned char const *data;
+    unsigned long long data_size;
+
+    unsigned long long file_size;
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    uint32_t checksum;
+#endif
+    unsigned char file_flags;
+
+    // Symbolic links are created during the scan already.
+    bool is_link;
+};
+
+static struct PayloadArchiveEntry *archive_entries = NULL;
+static long archive_entry_count = 0;
+static long archive_entries_allocated = 0;
+
+// Index of the next entry to be taken by a worker, changed atomically only.
+static long volatile archive_next_entry = 0;
+
+static struct PayloadArchiveEntry *addArchiveEntry(filename_char_t const *target_path) {
+    if (archive_entry_count == archive_entries_allocated) {
+        archive_entries_allocated = archive_entries_allocated ? archive_entries_allocated * 2 : 1024;
+
+        archive_entries = (struct PayloadArchiveEntry *)realloc(
+            archive_entries, archive_entries_allocated * sizeof(struct PayloadArchiveEntry));
+
+        if (archive_entries == NULL) {
+            fatalErrorMemory();
+        }
+    }
+
+    struct PayloadArchiveEntry *entry = &archive_entries[archive_entry_count];
+    archive_entry_count += 1;
+
+    memset(entry, 0, sizeof(*entry));
+    entry->target_path = strdupFilename(target_path);
+
+    if (entry->target_path == NULL) {
+        fatalErrorMemory();
+    }
+
+    return entry;
+}
+
+static long getNextArchiveEntryIndex(void) {
+#if defined(_WIN32)
+    return InterlockedIncrement(&archive_next_entry) - 1;
+#else
+    return __sync_fetch_and_add(&archive_next_entry, 1);
+#endif
+}
+
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+struct ArchiveWorkerContext {
+    ZSTD_DCtx *decompression_context;
+    void *output_buffer;
+    size_t output_buffer_size;
+};
+#endif
+
+static void unpackArchiveEntry(struct PayloadArchiveEntry const *entry
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+                               ,
+                               struct ArchiveWorkerContext *context
+#endif
+) {
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    if (entry->checksum == getFileCRC32(entry->target_path)) {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+        fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", entry->target_path);
+#endif
+        return;
+    }
+
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+    fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", entry->target_path);
+#endif
+#endif
+
+    FILE_HANDLE target_file = createFileForWritingChecked(entry->target_path);
+
 #if _NUITKA_ONEFILE_COMPRESSION_BOOL == 0
-    if (target_file != FILE_HANDLE_NULL) {
-        if (writeFileChunk(target_file, payload_current, file_size) == false) {
+    if (entry->file_size > 0) {
+        if (writeFileChunk(target_file, entry->data, (size_t)entry->file_size) == false) {
             fatalErrorTempFiles();
         }
     }
-
-    payload_current += file_size;
 #else
-    if (target_file != FILE_HANDLE_NULL) {
+    unsigned long long remaining = entry->file_size;
 
-        // Nothing available, make sure to make it available from existing input.
-        while (input.pos < input.size) {
-            // printf("available input %ld %ld\n", input.pos, input.size);
+    if (entry->data_size > 0) {
+        ZSTD_DCtx_reset(context->decompression_context, ZSTD_reset_session_only);
 
-            output.pos = 0;
-            output.size = ZSTD_DStreamOutSize();
+        ZSTD_inBuffer input = {entry->data, (size_t)entry->data_size, 0};
 
-            size_t const ret = ZSTD_decompressStream(dest_ctx, &output, &input);
+        for (;;) {
+            ZSTD_outBuffer output = {context->output_buffer, context->output_buffer_size, 0};
+
+            size_t const ret = ZSTD_decompressStream(context->decompression_context, &output, &input);
             if (ZSTD_isError(ret)) {
                 fatalErrorAttachedData();
             }
 
-            // printf("available output %ld %ld\n", output.pos, output.size);
+            if (output.pos > remaining) {
+                fatalErrorAttachedData();
+            }
 
-            if (writeFileChunk(target_file, (char const *)output.dst, output.pos) == false) {
+            if (writeFileChunk(target_file, output.dst, output.pos) == false) {
                 fatalErrorTempFiles();
             }
 
-            // printf("made output %ld %lld\n", output.pos, file_size);
-            file_size -= output.pos;
-            assert(file_size >= 0);
+            remaining -= output.pos;
+
+            // Frame is completely decoded and flushed.
+            if (ret == 0) {
+                break;
+            }
+
+            // Input is exhausted without completing the frame.
+            if (input.pos == input.size && output.pos < output.size) {
+                fatalErrorAttachedData();
+            }
         }
+    }
 
-        assert(file_size == 0);
+    if (remaining != 0) {
+        fatalErrorAttachedData();
     }
 #endif
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+    if (entry->file_flags & 1) {
+        makeFileExecutable(target_file);
+    }
+#endif
+
+    if (closeFile(target_file) == false) {
+        fatalErrorTempFiles();
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI archiveWorkerThread(LPVOID arg) {
 #else
-    while (file_size > 0) {
-        static char chunk[32768];
+static void *archiveWorkerThread(void *arg) {
+#endif
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+    struct ArchiveWorkerContext context;
 
-        long chunk_size;
+    context.decompression_context = ZSTD_createDCtx();
+    context.output_buffer_size = ZSTD_DStreamOutSize();
+    context.output_buffer = malloc(context.output_buffer_size);
 
-        // Doing min manually, as otherwise the compiler is confused from types.
-        if (file_size <= sizeof(chunk)) {
-            chunk_size = (long)file_size;
-        } else {
-            chunk_size = sizeof(chunk);
-        }
+    if (context.decompression_context == NULL || context.output_buffer == NULL) {
+        fatalErrorMemory();
+    }
+#endif
 
-        readPayloadChunk(chunk, chunk_size);
+    for (;;) {
+        long index = getNextArchiveEntryIndex();
 
-        if (target_file != FILE_HANDLE_NULL) {
-            if (writeFileChunk(target_file, chunk, chunk_size) == false) {
-                fatalErrorTempFiles();
-            }
+        if (index >= archive_entry_count) {
+            break;
         }
 
-        file_size -= chunk_size;
+        struct PayloadArchiveEntry const *entry = &archive_entries[index];
+
+        if (entry->is_link == false) {
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+            unpackArchiveEntry(entry, &context);
+#else
+            unpackArchiveEntry(entry);
+#endif
+        }
     }
 
-    assert(file_size == 0);
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+    ZSTD_freeDCtx(context.decompression_context);
+    free(context.output_buffer);
 #endif
+
+    return 0;
 }
 
-// Zero means, not yet created, created unsuccessfully, terminated already.
+static long getArchiveWorkerCount(void) {
 #if defined(_WIN32)
-HANDLE handle_process = 0;
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    long result = (long)system_info.dwNumberOfProcessors;
 #else
-pid_t handle_process = 0;
+    long result = sysconf(_SC_NPROCESSORS_ONLN);
 #endif
 
-static filename_char_t payload_path[4096] = {0};
+    if (result > MAX_ARCHIVE_WORKERS) {
+        result = MAX_ARCHIVE_WORKERS;
+    }
+
+    if (result > archive_entry_count) {
+        result = archive_entry_count;
+    }
+
+    if (result < 1) {
+        result = 1;
+    }
+
+    return result;
+}
+
+static void unpackArchiveEntries(void) {
+    long worker_count = getArchiveWorkerCount();
+
+#if defined(_WIN32)
+    HANDLE worker_threads[MAX_ARCHIVE_WORKERS];
+#else
+    pthread_t worker_threads[MAX_ARCHIVE_WORKERS];
+#endif
+    long started_count = 0;
+
+    // The current thread is a worker too, failing to start more threads is
+    // not an error, then just fewer workers are used.
+    for (long i = 1; i < worker_count; i++) {
+#if defined(_WIN32)
+        worker_threads[started_count] = CreateThread(NULL, 0, archiveWorkerThread, NULL, 0, NULL);
+
+        if (worker_threads[started_count] == NULL) {
+            break;
+        }
+#else
+        if (pthread_create(&worker_threads[started_count], NULL, archiveWorkerThread, NULL) != 0) {
+            break;
+        }
+#endif
+        started_count += 1;
+    }
+
+    archiveWorkerThread(NULL);
+
+    for (long i = 0; i < started_count; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(worker_threads[i], INFINITE);
+        CloseHandle(worker_threads[i]);
+#else
+        pthread_join(worker_threads[i], NULL);
+#endif
+    }
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    for (long i = 0; i < archive_entry_count; i++) {
+        addManifestEntry(archive_entries[i].target_path);
+    }
+#endif
+}
 
-#if _NUITKA_ONEFILE_TEMP_BOOL == 1
-static bool payload_created = false;
 #endif
 
 #define MAX_CREATED_DIRS 1024
@@ -974,16 +1480,25 @@ int main(int argc, char **argv) {
 
     NUITKA_PRINT_TIMING("ONEFILE: Header is OK.");
 
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    // For cached mode, the checksum of the whole payload follows uncompressed.
+    uint32_t payload_checksum;
+    readChunk(&payload_checksum, sizeof(payload_checksum));
+#endif
+
 // The 'X' stands for no compression, 'Y' is compressed, handle that.
 #if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
     if (header[2] != 'Y') {
         fatalErrorHeaderAttachedData();
     }
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
     initZSTD();
 
     input.src = payload_current;
     input.pos = 0;
     input.size = payload_size;
+#endif
 
     assert(payload_size > 0);
 #else
@@ -1006,129 +1521,153 @@ int main(int argc, char **argv) {
     payload_created = true;
 #endif
 
-    for (;;) {
-        filename_char_t *filename = readPayloadFilename();
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0 && _NUITKA_ONEFILE_FULL_VERIFY_BOOL == 0
+    bool needs_unpack =
+        checkManifest(payload_checksum, first_filename, sizeof(first_filename) / sizeof(filename_char_t)) == false;
 
-        // printf("Filename: " FILENAME_FORMAT_STR "\n", filename);
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+    fprintf(stderr, "MANIFEST %s.\n", needs_unpack ? "INVALID" : "VALID");
+#endif
+#else
+    bool needs_unpack = true;
+#endif
 
-        // Detect EOF from empty filename.
-        if (filename[0] == 0) {
-            break;
-        }
+    if (needs_unpack) {
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+        removeManifest();
+        first_filename[0] = 0;
+#endif
 
-        static filename_char_t target_path[4096] = {0};
-        target_path[0] = 0;
+        for (;;) {
+            filename_char_t *filename = readPayloadFilename();
 
-        appendStringSafeFilename(target_path, payload_path, sizeof(target_path) / sizeof(filename_char_t));
-        appendCharSafeFilename(target_path, FILENAME_SEP_CHAR, sizeof(target_path) / sizeof(filename_char_t));
-        appendStringSafeFilename(target_path, filename, sizeof(target_path) / sizeof(filename_char_t));
+            // printf("Filename: " FILENAME_FORMAT_STR "\n", filename);
 
-        if (first_filename[0] == 0) {
-            appendStringSafeFilename(first_filename, target_path, sizeof(target_path) / sizeof(filename_char_t));
-        }
+            // Detect EOF from empty filename.
+            if (filename[0] == 0) {
+                break;
+            }
+
+            static filename_char_t target_path[4096] = {0};
+            target_path[0] = 0;
+
+            appendStringSafeFilename(target_path, payload_path, sizeof(target_path) / sizeof(filename_char_t));
+            appendCharSafeFilename(target_path, FILENAME_SEP_CHAR, sizeof(target_path) / sizeof(filename_char_t));
+            appendStringSafeFilename(target_path, filename, sizeof(target_path) / sizeof(filename_char_t));
+
+            if (first_filename[0] == 0) {
+                appendStringSafeFilename(first_filename, target_path, sizeof(target_path) / sizeof(filename_char_t));
+            }
 
 #if !defined(_WIN32) && !defined(__MSYS__)
-        unsigned char file_flags = readPayloadFileFlagsValue();
+            unsigned char file_flags = readPayloadFileFlagsValue();
 #endif
 
 #if !defined(_WIN32) && !defined(__MSYS__)
-        if (file_flags & 2) {
-            filename_char_t *link_target_path = readPayloadFilename();
+            if (file_flags & 2) {
+                filename_char_t *link_target_path = readPayloadFilename();
 
-            // printf("Filename: " FILENAME_FORMAT_STR " symlink to " FILENAME_FORMAT_STR "\n", target_path,
-            // link_target_path);
+                // printf("Filename: " FILENAME_FORMAT_STR " symlink to " FILENAME_FORMAT_STR "\n", target_path,
+                // link_target_path);
 
-            createContainingDirectory(target_path);
+                createContainingDirectory(target_path);
 
-            unlink(target_path);
-            if (symlink(link_target_path, target_path) != 0) {
-                fatalErrorTempFileCreate(target_path);
-            }
+                unlink(target_path);
+                if (symlink(link_target_path, target_path) != 0) {
+                    fatalErrorTempFileCreate(target_path);
+                }
 
-            continue;
-        }
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+                addArchiveEntry(target_path)->is_link = true;
+#elif _NUITKA_ONEFILE_TEMP_BOOL == 0
+                addManifestEntry(target_path);
 #endif
-        // _putws(target_path);
-        unsigned long long file_size = readPayloadSizeValue();
 
-        bool needs_write = true;
+                continue;
+            }
+#endif
+            // _putws(target_path);
+            unsigned long long file_size = readPayloadSizeValue();
 
 #if _NUITKA_ONEFILE_TEMP_BOOL == 0
-        uint32_t contained_file_checksum = readPayloadChecksumValue();
-        uint32_t existing_file_checksum = getFileCRC32(target_path);
-
-        if (contained_file_checksum == existing_file_checksum) {
-            needs_write = false;
-
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
-            fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", target_path);
-#endif
-        } else {
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
-            fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", target_path);
-#endif
-        }
+            uint32_t contained_file_checksum = readPayloadChecksumValue();
 #endif
 
 #if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
 #if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
-        uint32_t contained_archive_file_size = readArchiveFileSizeValue();
-
-        input.src = payload_current;
-        input.pos = 0;
-        input.size = contained_archive_file_size;
-
-        output.pos = 0;
-        output.size = 0;
-
-        payload_current += contained_archive_file_size;
-#endif
+            unsigned long long data_size = readArchiveFileSizeValue();
+#else
+            unsigned long long data_size = file_size;
 #endif
-        FILE_HANDLE target_file = FILE_HANDLE_NULL;
-
-        if (needs_write) {
+            // Directories are created here, the workers only write files.
             createContainingDirectory(target_path);
-            target_file = createFileForWritingChecked(target_path);
-        }
 
-        writeContainedFile(target_file, file_size);
+            struct PayloadArchiveEntry *archive_entry = addArchiveEntry(target_path);
 
+            archive_entry->data = payload_current;
+            archive_entry->data_size = data_size;
+            archive_entry->file_size = file_size;
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+            archive_entry->checksum = contained_file_checksum;
+#endif
 #if !defined(_WIN32) && !defined(__MSYS__)
-        if ((file_flags & 1) && (target_file != FILE_HANDLE_NULL)) {
-            int fd = fileno(target_file);
+            archive_entry->file_flags = file_flags;
+#endif
 
-            struct stat stat_buffer;
-            int res = fstat(fd, &stat_buffer);
+            payload_current += data_size;
+#else
+            bool needs_write = true;
 
-            if (res == -1) {
-                printOSErrorMessage("fstat", errno);
-            }
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+            uint32_t existing_file_checksum = getFileCRC32(target_path);
 
-            // User shall be able to execute if at least.
-            stat_buffer.st_mode |= S_IXUSR;
+            if (contained_file_checksum == existing_file_checksum) {
+                needs_write = false;
 
-            // Follow read flags for group, others according to umask.
-            if ((stat_buffer.st_mode & S_IRGRP) != 0) {
-                stat_buffer.st_mode |= S_IXOTH;
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+                fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", target_path);
+#endif
+            } else {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+                fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", target_path);
+#endif
             }
+#endif
+
+            FILE_HANDLE target_file = FILE_HANDLE_NULL;
 
-            if ((stat_buffer.st_mode & S_IRGRP) != 0) {
-                stat_buffer.st_mode |= S_IXOTH;
+            if (needs_write) {
+                createContainingDirectory(target_path);
+                target_file = createFileForWritingChecked(target_path);
             }
 
-            res = fchmod(fd, stat_buffer.st_mode);
+            writeContainedFile(target_file, file_size);
 
-            if (res == -1) {
-                printOSErrorMessage("fchmod", errno);
+#if !defined(_WIN32) && !defined(__MSYS__)
+            if ((file_flags & 1) && (target_file != FILE_HANDLE_NULL)) {
+                makeFileExecutable(target_file);
             }
-        }
 #endif
 
-        if (target_file != FILE_HANDLE_NULL) {
-            if (closeFile(target_file) == false) {
-                fatalErrorTempFiles();
+            if (target_file != FILE_HANDLE_NULL) {
+                if (closeFile(target_file) == false) {
+                    fatalErrorTempFiles();
+                }
             }
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+            addManifestEntry(target_path);
+#endif
+#endif
         }
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+        unpackArchiveEntries();
+#endif
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+        writeManifest(payload_checksum);
+#endif
     }
 
     NUITKA_PRINT_TIMING("ONEFILE: Finishing decompression, cleanup payload.");
@@ -1139,7 +1678,7 @@ int main(int argc, char **argv) {
     exe_file_updatable = true;
 #endif
 
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
     releaseZSTD();
 #endif
 
@@ -6,6 +6,7 @@
 """
 
 from .CodeHelpers import generateStatementSequenceCode
+from .ConstantCodes import getLazyConstantsLoadCode
 from .Emission import SourceCodeCollector
 from .FunctionCodes import (
     finalizeFunctionLocalVariables,
@@ -97,6 +98,10 @@ def getAsyncgenObjectCode(
     if needs_generator_return:
         generator_exit += template_asyncgen_return_exit % {}
 
+    # Lazy constants used are unpacked on first execution.
+    function_entry_codes = SourceCodeCollector()
+    getLazyConstantsLoadCode(emit=function_entry_codes, context=context)
+
     function_locals = context.variable_storage.makeCFunctionLevelDeclarations()
 
     local_type_decl = context.variable_storage.makeCStructLevelDeclarations()
@@ -121,7 +126,7 @@ struct %(function_identifier)s_locals *asyncgen_heap = \
 
     return template_asyncgen_object_body % {
         "function_identifier": function_identifier,
-        "function_body": indented(function_codes.codes),
+        "function_body": indented(function_entry_codes.codes + function_codes.codes),
         "heap_declaration": indented(heap_declaration),
         "has_heap_declaration": 1 if heap_declaration != "" else 0,
         "function_local_types": indented(local_type_decl),
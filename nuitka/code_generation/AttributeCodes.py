@@ -7,6 +7,7 @@ Attribute lookup, setting.
 """
 
 from nuitka import Options
+from nuitka.PythonVersions import python_version
 
 from .CodeHelpers import (
     decideConversionCheckNeeded,
@@ -20,6 +21,7 @@ from .PythonAPICodes import (
     generateCAPIObjectCode0,
     makeArgDescFromExpression,
 )
+from .PythonPgoCodes import getPythonPgoSiteName, getPythonPgoTypeTraceCode
 
 
 def generateAssignmentAttributeCode(statement, emit, context):
@@ -98,6 +100,16 @@ def getAttributeLookupCode(
         emit("%s = LOOKUP_ATTRIBUTE_DICT_SLOT(tstate, %s);" % (to_name, source_name))
     elif attribute_name == "__class__":
         emit("%s = LOOKUP_ATTRIBUTE_CLASS_SLOT(tstate, %s);" % (to_name, source_name))
+    elif python_version >= 0x380:
+        emit(
+            "%s = LOOKUP_ATTRIBUTE_CACHED(tstate, %s, %s, &%s);"
+            % (
+                to_name,
+                source_name,
+                context.getConstantCode(attribute_name),
+                context.variable_storage.addAttributeCacheDeclaration(),
+            )
+        )
     else:
         emit(
             "%s = LOOKUP_ATTRIBUTE(tstate, %s, %s);"
@@ -124,6 +136,14 @@ def generateAttributeLookupCode(to_name, expression, emit, context):
 
     attribute_name = expression.getAttributeName()
 
+    getPythonPgoTypeTraceCode(
+        site_name=getPythonPgoSiteName("Attribute", expression.getSourceReference()),
+        operand1_name=source_name,
+        operand2_name=None,
+        emit=emit,
+        context=context,
+    )
+
     with withObjectCodeTemporaryAssignment(
         to_name, "attribute_value", expression, emit, context
     ) as value_name:
@@ -144,10 +164,22 @@ def generateAttributeLookupCode(to_name, expression, emit, context):
 def getAttributeAssignmentCode(target_name, attribute_name, value_name, emit, context):
     res_name = context.getBoolResName()
 
-    emit(
-        "%s = SET_ATTRIBUTE(tstate, %s, %s, %s);"
-        % (res_name, target_name, attribute_name, value_name)
-    )
+    if python_version >= 0x380:
+        emit(
+            "%s = SET_ATTRIBUTE_CACHED(tstate, %s, %s, %s, &%s);"
+            % (
+                res_name,
+                target_name,
+                attribute_name,
+                value_name,
+                context.variable_storage.addAttributeCacheDeclaration(),
+            )
+        )
+    else:
+        emit(
+            "%s = SET_ATTRIBUTE(tstate, %s, %s, %s);"
+            % (res_name, target_name, attribute_name, value_name)
+        )
 
     getErrorExitBoolCode(
         condition="%s == false" % res_name,
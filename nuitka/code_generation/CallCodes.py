@@ -9,7 +9,10 @@ able to execute them without creating the argument dictionary at all.
 
 """
 
+from contextlib import contextmanager
+
 from nuitka.Constants import isMutable
+from nuitka.PythonVersions import python_version
 from nuitka.utils.Jinja2 import getTemplateC
 
 from .CodeHelpers import (
@@ -19,6 +22,7 @@ from .CodeHelpers import (
 )
 from .ErrorCodes import getErrorExitCode
 from .LineNumberCodes import emitLineNumberUpdateCode
+from .PythonPgoCodes import getPythonPgoSiteName, getPythonPgoTypeTraceCode
 from .templates.CodeTemplatesModules import (
     template_header_guard,
     template_helper_impl_decl,
@@ -408,6 +412,15 @@ def generateCallCode(to_name, expression, emit, context):
             expression=called, emit=emit, context=context
         )
 
+    # For method calls, this is the instance the method is looked up from.
+    getPythonPgoTypeTraceCode(
+        site_name=getPythonPgoSiteName("Call", expression.getSourceReference()),
+        operand1_name=called_name,
+        operand2_name=None,
+        emit=emit,
+        context=context,
+    )
+
     with withObjectCodeTemporaryAssignment(
         to_name, "call_result", expression, emit, context
     ) as result_name:
@@ -545,15 +558,35 @@ def getCallCodeNoArgs(to_name, called_name, expression, emit, context):
     context.addCleanupTempName(to_name)
 
 
+def _useMethodCallCache(arg_size):
+    """Decide if a method call with a constant attribute name gets a cache.
+
+    The cached helper falls back to the pre-generated method call helpers,
+    which only exist up to 10 arguments.
+    """
+    return python_version >= 0x380 and arg_size <= 10
+
+
 def _getInstanceCallCodeNoArgs(
     to_name, called_name, called_attribute_name, expression, emit, context
 ):
     emitLineNumberUpdateCode(expression, emit, context)
 
-    emit(
-        "%s = CALL_METHOD_NO_ARGS(tstate, %s, %s);"
-        % (to_name, called_name, called_attribute_name)
-    )
+    if _useMethodCallCache(0):
+        emit(
+            "%s = CALL_METHOD_NO_ARGS_CACHED(tstate, %s, %s, &%s);"
+            % (
+                to_name,
+                called_name,
+                called_attribute_name,
+                context.variable_storage.addMethodCallCacheDeclaration(),
+            )
+        )
+    else:
+        emit(
+            "%s = CALL_METHOD_NO_ARGS(tstate, %s, %s);"
+            % (to_name, called_name, called_attribute_name)
+        )
 
     getErrorExitCode(
         check_name=to_name,
@@ -572,6 +605,48 @@ quick_instance_calls_used = set()
 quick_mixed_calls_used = set()
 
 
+def _getQuickCallsUsageSets():
+    return (
+        quick_calls_used,
+        quick_tuple_calls_used,
+        quick_instance_calls_used,
+        quick_mixed_calls_used,
+    )
+
+
+@contextmanager
+def withQuickCallsUsageRecording():
+    """Record the quick call helpers used by code generated in the block.
+
+    The result is for "addQuickCallsUsage" in a later compilation, where
+    the code is not generated again.
+    """
+
+    usage_sets = _getQuickCallsUsageSets()
+    saved_sets = [set(usage_set) for usage_set in usage_sets]
+
+    for usage_set in usage_sets:
+        usage_set.clear()
+
+    recorded = []
+
+    try:
+        yield recorded
+    finally:
+        for usage_set, saved_set in zip(usage_sets, saved_sets):
+            recorded.append(sorted(usage_set))
+
+            usage_set.update(saved_set)
+
+
+def addQuickCallsUsage(usage):
+    for usage_set, values in zip(_getQuickCallsUsageSets(), usage):
+        # Mixed calls use tuples, which become lists when stored as JSON.
+        usage_set.update(
+            tuple(value) if type(value) is list else value for value in values
+        )
+
+
 def _getInstanceCallCodePosArgsQuick(
     to_name,
     called_name,
@@ -590,11 +665,46 @@ def _getInstanceCallCodePosArgsQuick(
 
     # For one argument, we have a dedicated helper function that might
     # be more efficient.
-    if arg_size == 1:
+    if arg_size == 1 and _useMethodCallCache(arg_size):
+        emit(
+            """%s = CALL_METHOD_WITH_SINGLE_ARG_CACHED(tstate, %s, %s, %s, &%s);"""
+            % (
+                to_name,
+                called_name,
+                called_attribute_name,
+                arg_names[0],
+                context.variable_storage.addMethodCallCacheDeclaration(),
+            )
+        )
+    elif arg_size == 1:
         emit(
             """%s = CALL_METHOD_WITH_SINGLE_ARG(tstate, %s, %s, %s);"""
             % (to_name, called_name, called_attribute_name, arg_names[0])
         )
+    elif _useMethodCallCache(arg_size):
+        emit(
+            """\
+{
+    PyObject *call_args[] = {%(call_args)s};
+    %(to_name)s = CALL_METHOD_WITH_ARGS_CACHED(
+        tstate,
+        %(called_name)s,
+        %(called_attribute_name)s,
+        call_args,
+        %(arg_size)d,
+        &%(cache_name)s
+    );
+}
+"""
+            % {
+                "call_args": ", ".join(str(arg_name) for arg_name in arg_names),
+                "to_name": to_name,
+                "arg_size": arg_size,
+                "called_name": called_name,
+                "called_attribute_name": called_attribute_name,
+                "cache_name": context.variable_storage.addMethodCallCacheDeclaration(),
+            }
+        )
     else:
         quick_instance_calls_used.add(arg_size)
 
@@ -691,7 +801,18 @@ def _getInstanceCallCodeFromTuple(
 
     emitLineNumberUpdateCode(expression, emit, context)
 
-    if arg_size == 1:
+    if _useMethodCallCache(arg_size):
+        template = """\
+%(to_name)s = CALL_METHOD_WITH_ARGS_CACHED(
+    tstate,
+    %(called_name)s,
+    %(called_attribute_name)s,
+    &PyTuple_GET_ITEM(%(arg_tuple)s, 0),
+    %(arg_size)d,
+    &%(cache_name)s
+);
+"""
+    elif arg_size == 1:
         template = """\
 %(to_name)s = CALL_METHOD_WITH_SINGLE_ARG(
     tstate,
@@ -718,6 +839,11 @@ def _getInstanceCallCodeFromTuple(
             "called_name": called_name,
             "called_attribute_name": called_attribute_name,
             "arg_tuple": arg_tuple,
+            "cache_name": (
+                context.variable_storage.addMethodCallCacheDeclaration()
+                if _useMethodCallCache(arg_size)
+                else None
+            ),
         }
     )
 
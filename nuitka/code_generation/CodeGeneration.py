@@ -12,6 +12,8 @@ branches and make a code block out of it. But it doesn't contain any target
 language syntax.
 """
 
+from contextlib import contextmanager
+
 from nuitka.nodes.AttributeNodesGenerated import (
     attribute_classes,
     attribute_typed_classes,
@@ -66,7 +68,12 @@ from .BuiltinCodes import (
     generateBuiltinXrange2Code,
     generateBuiltinXrange3Code,
 )
-from .CallCodes import generateCallCode, getCallsCode
+from .CallCodes import (
+    addQuickCallsUsage,
+    generateCallCode,
+    getCallsCode,
+    withQuickCallsUsageRecording,
+)
 from .ClassCodes import (
     generateBuiltinSuper1Code,
     generateBuiltinSuperCode,
@@ -89,9 +96,11 @@ from .ConditionalCodes import (
     generateConditionalCode,
 )
 from .ConstantCodes import (
+    addDistributionMetadataUsage,
     generateConstantGenericAliasCode,
     generateConstantReferenceCode,
     getConstantsDefinitionCode,
+    withDistributionMetadataRecording,
 )
 from .CoroutineCodes import (
     generateAsyncIterCode,
@@ -587,6 +596,31 @@ def generateHelpersCode():
     )
 
 
+@contextmanager
+def withModuleCodeUsageRecording():
+    """Record what code generated in the block needs from the helpers code.
+
+    That is helper functions and constants, which are created once for all
+    modules. The result is for "addModuleCodeUsage" where the code of the
+    module is not generated, e.g. when it is cached or done in another
+    process.
+    """
+
+    usage = {}
+
+    with withQuickCallsUsageRecording() as quick_calls_usage:
+        with withDistributionMetadataRecording() as distribution_metadata_usage:
+            yield usage
+
+    usage["quick_calls"] = quick_calls_usage
+    usage["distribution_metadata"] = distribution_metadata_usage
+
+
+def addModuleCodeUsage(usage):
+    addQuickCallsUsage(usage["quick_calls"])
+    addDistributionMetadataUsage(usage["distribution_metadata"])
+
+
 # TODO: Some of these have names that are way too long, and this should be more automatic in
 # standard cases, e.g. through generation.
 # pylint: disable=line-too-long
@@ -37,6 +37,17 @@ from .ErrorCodes import (
     getReleaseCodes,
 )
 from .ExpressionCTypeSelectionHelpers import decideExpressionCTypes
+from .FloatCodes import decideCFloatComparison, generateCFloatComparisonCode
+from .IntCodes import (
+    decideCIntOrLongComparison,
+    generateCIntOrLongComparisonCode,
+)
+from .PythonPgoCodes import (
+    getPythonPgoGuardedHelperCallCode,
+    getPythonPgoSiteName,
+    getPythonPgoTypeTraceCode,
+    selectPythonPgoCodeHelper,
+)
 
 
 def _handleArgumentSwapAndInversion(
@@ -64,6 +75,32 @@ def getRichComparisonCode(
     # available, and can be used as a fallback.
     # pylint: disable=too-many-branches,too-many-locals,too-many-statements
 
+    if decideCFloatComparison(
+        to_name=to_name, comparator=comparator, left=left, right=right, context=context
+    ):
+        generateCFloatComparisonCode(
+            to_name=to_name,
+            comparator=comparator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+        return
+
+    if decideCIntOrLongComparison(
+        to_name=to_name, comparator=comparator, left=left, right=right, context=context
+    ):
+        generateCIntOrLongComparisonCode(
+            to_name=to_name,
+            comparator=comparator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+        return
+
     # TODO: Move the value_name to a context generator, then this will be
     # a bit less complex.
     (
@@ -196,15 +233,48 @@ def getRichComparisonCode(
     else:
         value_name = to_name
 
-    emit(
-        "%s = %s(%s, %s);"
-        % (
-            value_name,
-            helper_function,
-            arg1_name,
-            arg2_name,
+    # Generic helpers only, let Python PGO find what types are used, and
+    # provide a fast path for them.
+    if helper_function.endswith("_OBJECT_OBJECT"):
+        pgo_site_name = getPythonPgoSiteName(comparator, source_ref)
+
+        getPythonPgoTypeTraceCode(
+            site_name=pgo_site_name,
+            operand1_name=arg1_name,
+            operand2_name=arg2_name,
+            emit=emit,
+            context=context,
+        )
+
+        pgo_helper = selectPythonPgoCodeHelper(
+            prefix=prefix,
+            specialized_helpers_set=specialized_helpers_set,
+            result_type=helper_type,
+            site_name=pgo_site_name,
+            context=context,
+        )
+    else:
+        pgo_helper = None
+
+    if pgo_helper is not None:
+        getPythonPgoGuardedHelperCallCode(
+            value_name=value_name,
+            helper_function=helper_function,
+            pgo_helper=pgo_helper,
+            arg1_name=arg1_name,
+            arg2_name=arg2_name,
+            emit=emit,
+        )
+    else:
+        emit(
+            "%s = %s(%s, %s);"
+            % (
+                value_name,
+                helper_function,
+                arg1_name,
+                arg2_name,
+            )
         )
-    )
 
     if value_name.getCType().hasErrorIndicator():
         getErrorExitCode(
@@ -15,6 +15,7 @@ for a single module only.
 
 import os
 import sys
+from contextlib import contextmanager
 
 from nuitka import Options
 from nuitka.__past__ import unicode
@@ -33,7 +34,10 @@ from .CodeHelpers import withObjectCodeTemporaryAssignment
 from .ErrorCodes import getAssertionCode
 from .GlobalConstants import getConstantDefaultPopulation
 from .Namify import namifyConstant
-from .templates.CodeTemplatesConstants import template_constants_reading
+from .templates.CodeTemplatesConstants import (
+    template_constants_reading,
+    template_lazy_constant_load,
+)
 from .templates.CodeTemplatesModules import template_header_guard
 
 
@@ -82,6 +86,20 @@ def generateConstantGenericAliasCode(to_name, expression, emit, context):
         context.addCleanupTempName(value_name)
 
 
+def getLazyConstantsLoadCode(emit, context):
+    """Code to unpack the lazy constants a function uses, on its entry.
+
+    These are left unpacked by the module loading, and only the first
+    execution of a function that uses them, will do it.
+    """
+
+    for constant_code, lazy_index in context.getLazyConstantUses():
+        emit(
+            template_lazy_constant_load
+            % {"constant_code": constant_code, "lazy_index": lazy_index}
+        )
+
+
 def getConstantsDefinitionCode():
     """Create the code code "__constants.c" and "__constants.h" files.
 
@@ -227,6 +245,58 @@ def getDistributionMetadataValues():
     return sorted(metadata_values.items())
 
 
+@contextmanager
+def withDistributionMetadataRecording():
+    """Record the distribution metadata added by code generated in the block.
+
+    The result is for "addDistributionMetadataUsage" in another compilation
+    or process, where the code is not generated.
+    """
+
+    saved_values = dict(metadata_values)
+    metadata_values.clear()
+
+    recorded = []
+
+    try:
+        yield recorded
+    finally:
+        for distribution_name, value in sorted(metadata_values.items()):
+            recorded.append(
+                [
+                    distribution_name,
+                    value.module_name,
+                    value.metadata,
+                    value.entry_points_data,
+                    list(value.reasons),
+                ]
+            )
+
+        metadata_values.clear()
+        metadata_values.update(saved_values)
+
+        addDistributionMetadataUsage(recorded)
+
+
+def addDistributionMetadataUsage(usage):
+    for (
+        distribution_name,
+        module_name,
+        metadata,
+        entry_points_data,
+        reasons,
+    ) in usage:
+        if distribution_name not in metadata_values:
+            metadata_values[distribution_name] = MetaDataDescription(
+                module_name=module_name,
+                metadata=metadata,
+                entry_points_data=entry_points_data,
+                reasons=list(reasons),
+            )
+        else:
+            metadata_values[distribution_name].reasons.extend(reasons)
+
+
 #     Part of "Nuitka", an optimizing Python compiler that is compatible and
 #     integrates with CPython, but also works on its own.
 #
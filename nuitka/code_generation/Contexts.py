@@ -320,6 +320,21 @@ class CodeObjectsMixin(object):
         return getStringHash("-".join(str(s) for s in key))
 
 
+class LazyConstantsMixin(object):
+    # Mixins are not allowed to specify slots, pylint: disable=assigning-non-slot
+    __slots__ = ()
+
+    def __init__(self):
+        # Lazy constants used by the context code, to be unpacked on its entry.
+        self.lazy_constants = {}
+
+    def addLazyConstantUse(self, constant_code, lazy_index):
+        self.lazy_constants[constant_code] = lazy_index
+
+    def getLazyConstantUses(self):
+        return sorted(iterItems(self.lazy_constants), key=lambda item: item[1])
+
+
 class PythonContextBase(getMetaClassBase("Context", require_slots=True)):
     __slots__ = ("source_ref", "current_source_ref")
 
@@ -745,6 +760,7 @@ class PythonModuleContext(
     FrameDeclarationsMixin,
     TempMixin,
     CodeObjectsMixin,
+    LazyConstantsMixin,
     ReturnReleaseModeMixin,
     ReturnValueNameMixin,
     PythonContextBase,
@@ -784,6 +800,8 @@ class PythonModuleContext(
         "cleanup_names",
         # CodeObjectsMixin
         "code_objects",
+        # LazyConstantsMixin
+        "lazy_constants",
         # ReturnReleaseModeMixin
         "return_release_mode",
         "return_exit",
@@ -796,6 +814,7 @@ class PythonModuleContext(
 
         TempMixin.__init__(self)
         CodeObjectsMixin.__init__(self)
+        LazyConstantsMixin.__init__(self)
         FrameDeclarationsMixin.__init__(self)
         ReturnReleaseModeMixin.__init__(self)
 
@@ -816,7 +835,9 @@ class PythonModuleContext(
         self.function_table_entries = []
 
         self.constant_accessor = ConstantAccessor(
-            top_level_name="mod_consts", data_filename=data_filename
+            top_level_name="mod_consts",
+            data_filename=data_filename,
+            lazy_constants=Options.shallUseLazyConstants(),
         )
 
         self.module_init_codes = []
@@ -872,14 +893,28 @@ class PythonModuleContext(
         return False
 
     def getConstantCode(self, constant, deep_check=False):
+        return self.getConstantCodeForUser(
+            constant=constant, deep_check=deep_check, user=self
+        )
+
+    def getConstantCodeForUser(self, constant, deep_check, user):
         if deep_check and Options.is_debug:
             assert not isMutable(constant)
 
-        return self.constant_accessor.getConstantCode(constant)
+        constant_code = self.constant_accessor.getConstantCode(constant)
+
+        lazy_index = self.constant_accessor.getLazyConstantIndex(constant_code)
+        if lazy_index is not None:
+            user.addLazyConstantUse(constant_code, lazy_index)
+
+        return constant_code
 
     def getConstantsCount(self):
         return self.constant_accessor.getConstantsCount()
 
+    def getLazyConstantsCount(self):
+        return self.constant_accessor.getLazyConstantsCount()
+
     def getModuleInitCodes(self):
         return self.module_init_codes
 
@@ -904,6 +939,7 @@ class PythonModuleContext(
 class PythonFunctionContext(
     FrameDeclarationsMixin,
     TempMixin,
+    LazyConstantsMixin,
     ReturnReleaseModeMixin,
     ReturnValueNameMixin,
     PythonChildContextBase,
@@ -931,6 +967,8 @@ class PythonFunctionContext(
         "exception_keepers",
         "preserver_variable_declaration",
         "cleanup_names",
+        # LazyConstantsMixin
+        "lazy_constants",
         # ReturnReleaseModeMixin
         "return_release_mode",
         "return_exit",
@@ -942,6 +980,7 @@ class PythonFunctionContext(
         PythonChildContextBase.__init__(self, parent=parent)
 
         TempMixin.__init__(self)
+        LazyConstantsMixin.__init__(self)
         FrameDeclarationsMixin.__init__(self)
         ReturnReleaseModeMixin.__init__(self)
         ReturnValueNameMixin.__init__(self)
@@ -978,6 +1017,12 @@ class PythonFunctionContext(
         # TODO: Determine this at compile time for enhanced optimizations.
         return True
 
+    def getConstantCode(self, constant, deep_check=False):
+        # Lazy constants are to be unpacked by the function, not the module.
+        return self.parent.getConstantCodeForUser(
+            constant=constant, deep_check=deep_check, user=self
+        )
+
     def getCodeObjectHandle(self, code_object):
         return self.parent.getCodeObjectHandle(code_object)
 
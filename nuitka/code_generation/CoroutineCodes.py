@@ -10,6 +10,7 @@ from .CodeHelpers import (
     generateStatementSequenceCode,
     withObjectCodeTemporaryAssignment,
 )
+from .ConstantCodes import getLazyConstantsLoadCode
 from .Emission import SourceCodeCollector
 from .ErrorCodes import getErrorExitCode
 from .FunctionCodes import (
@@ -105,6 +106,10 @@ def getCoroutineObjectCode(
             "return_value": context.getReturnValueName()
         }
 
+    # Lazy constants used are unpacked on first execution.
+    function_entry_codes = SourceCodeCollector()
+    getLazyConstantsLoadCode(emit=function_entry_codes, context=context)
+
     function_locals = context.variable_storage.makeCFunctionLevelDeclarations()
 
     local_type_decl = context.variable_storage.makeCStructLevelDeclarations()
@@ -129,7 +134,7 @@ struct %(function_identifier)s_locals *coroutine_heap = \
 
     return template_coroutine_object_body % {
         "function_identifier": function_identifier,
-        "function_body": indented(function_codes.codes),
+        "function_body": indented(function_entry_codes.codes + function_codes.codes),
         "heap_declaration": indented(heap_declaration),
         "has_heap_declaration": 1 if heap_declaration != "" else 0,
         "function_local_types": indented(local_type_decl),
@@ -0,0 +1,303 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Float related codes, arithmetic and comparisons done on C "double" values.
+
+Local variables that are only ever assigned float values, are held as C
+"double", and operations on them, on float constants and on float typed
+values, are done in C directly. Float objects are only created when the
+value escapes, e.g. is passed to calls, returned or stored into containers.
+"""
+
+from nuitka.__past__ import long
+from nuitka.nodes.shapes.BuiltinTypeShapes import tshape_float
+
+from .c_types.CTypeCFloats import CTypeCFloat
+from .CodeHelpers import generateExpressionCode
+from .ErrorCodes import getErrorExitReleaseCode, getFrameVariableTypeDescriptionCode
+from .Indentation import indented
+from .LineNumberCodes import getErrorLineNumberUpdateCode
+from .templates.CodeTemplatesExceptions import (
+    template_error_format_string_exception,
+)
+from .VariableCodes import getLocalVariableDeclaration
+
+_cfloat_binary_operators = {
+    "Add": "+",
+    "Sub": "-",
+    "Mult": "*",
+    "TrueDiv": "/",
+}
+
+_cfloat_unary_operators = {
+    "USub": "-",
+    "UAdd": "+",
+}
+
+_cfloat_comparators = {
+    "Lt": "<",
+    "LtE": "<=",
+    "Gt": ">",
+    "GtE": ">=",
+    "Eq": "==",
+    "NotEq": "!=",
+}
+
+# Integer values up to this are exactly represented as C double.
+_cfloat_exact_int_limit = 2**53
+
+
+def _isCFloatConstant(expression):
+    if not expression.isCompileTimeConstant():
+        return False
+
+    constant = expression.getCompileTimeConstant()
+
+    if type(constant) is float:
+        return True
+
+    # Integers mixed with floats are converted, and must not lose precision
+    # doing it.
+    return (
+        type(constant) in (int, long)
+        and -_cfloat_exact_int_limit <= constant <= _cfloat_exact_int_limit
+    )
+
+
+def _isCFloatOperand(expression):
+    return expression.getTypeShape() is tshape_float or _isCFloatConstant(expression)
+
+
+def _isCFloatVariableRef(expression, context):
+    if not expression.isExpressionVariableRefOrTempVariableRef():
+        return False
+
+    variable = expression.getVariable()
+
+    if variable.isModuleVariable():
+        return False
+
+    variable_declaration = getLocalVariableDeclaration(
+        context, variable, expression.getVariableTrace()
+    )
+
+    return variable_declaration.c_type == "double"
+
+
+def _getBinaryOperator(operator):
+    # For floats, in-place operations are the same as binary ones.
+    if operator[0] == "I":
+        operator = operator[1:]
+
+    return _cfloat_binary_operators.get(operator)
+
+
+def _isCFloatOperation(expression):
+    if expression.isExpressionOperationBinary():
+        return (
+            _getBinaryOperator(expression.getOperator()) is not None
+            and expression.getTypeShape() is tshape_float
+            and _isCFloatOperand(expression.subnode_left)
+            and _isCFloatOperand(expression.subnode_right)
+        )
+    elif expression.isExpressionOperationUnary():
+        return (
+            expression.getOperator() in _cfloat_unary_operators
+            and expression.subnode_operand.getTypeShape() is tshape_float
+        )
+    else:
+        return False
+
+
+def _isCFloatValue(expression, context):
+    """Is the value already a C double, or computed as one."""
+
+    return _isCFloatVariableRef(expression, context) or _isCFloatOperation(expression)
+
+
+def isCFloatAssignmentSource(expression, context):
+    """Can this be assigned to a C double variable without an object."""
+
+    return _isCFloatConstant(expression) or _isCFloatValue(expression, context)
+
+
+def _getCFloatOperandCode(expression, emit, context):
+    if _isCFloatConstant(expression):
+        return CTypeCFloat.getConstantValueCode(expression.getCompileTimeConstant())
+
+    if _isCFloatVariableRef(expression, context):
+        return str(
+            getLocalVariableDeclaration(
+                context, expression.getVariable(), expression.getVariableTrace()
+            )
+        )
+
+    value_name = context.allocateTempName("float_value", "double")
+
+    if _isCFloatOperation(expression):
+        generateExpressionCode(
+            to_name=value_name, expression=expression, emit=emit, context=context
+        )
+    else:
+        object_name = context.allocateTempName("float_object")
+
+        generateExpressionCode(
+            to_name=object_name, expression=expression, emit=emit, context=context
+        )
+
+        CTypeCFloat.emitAssignConversionCode(
+            to_name=value_name,
+            value_name=object_name,
+            needs_check=False,
+            emit=emit,
+            context=context,
+        )
+
+    return value_name
+
+
+def _getCFloatZeroDivisionCheckCode(divisor_code, emit, context):
+    (
+        exception_state_name,
+        _exception_lineno,
+    ) = context.variable_storage.getExceptionVariableDescriptions()
+
+    emit(
+        template_error_format_string_exception
+        % {
+            "condition": "unlikely(%s == 0.0)" % divisor_code,
+            "exception_exit": context.getExceptionEscape(),
+            "set_exception": indented(
+                (
+                    'SET_CURRENT_EXCEPTION_TYPE0_STR(tstate, PyExc_ZeroDivisionError, "float division by zero");',
+                    "FETCH_ERROR_OCCURRED_STATE(tstate, &%s);" % exception_state_name,
+                )
+            ),
+            "release_temps": indented(getErrorExitReleaseCode(context)),
+            "var_description_code": indented(
+                getFrameVariableTypeDescriptionCode(context)
+            ),
+            "line_number_code": indented(getErrorLineNumberUpdateCode(context)),
+        }
+    )
+
+
+def _getCFloatResultCode(to_name, value_code, emit, context):
+    if to_name.c_type == "double":
+        emit("%s = %s;" % (to_name, value_code))
+    else:
+        emit("%s = MAKE_FLOAT_FROM_DOUBLE(%s);" % (to_name, value_code))
+
+        context.addCleanupTempName(to_name)
+
+
+def decideCFloatBinaryOperation(to_name, operator, left, right, context):
+    if _getBinaryOperator(operator) is None:
+        return False
+
+    if to_name.c_type not in ("double", "PyObject *"):
+        return False
+
+    if not _isCFloatOperand(left) or not _isCFloatOperand(right):
+        return False
+
+    # One must be a float, otherwise it's not a float operation.
+    if left.getTypeShape() is not tshape_float:
+        if right.getTypeShape() is not tshape_float:
+            return False
+
+    # Only worth it, if either the result or an argument need not be an object,
+    # otherwise the helpers for float objects are just as good.
+    return (
+        to_name.c_type == "double"
+        or _isCFloatValue(left, context)
+        or _isCFloatValue(right, context)
+    )
+
+
+def generateCFloatBinaryOperationCode(to_name, operator, left, right, emit, context):
+    left_code = _getCFloatOperandCode(left, emit, context)
+    right_code = _getCFloatOperandCode(right, emit, context)
+
+    c_operator = _getBinaryOperator(operator)
+
+    if c_operator == "/":
+        if not _isCFloatConstant(right) or float(right.getCompileTimeConstant()) == 0.0:
+            _getCFloatZeroDivisionCheckCode(
+                divisor_code=right_code, emit=emit, context=context
+            )
+
+    _getCFloatResultCode(
+        to_name=to_name,
+        value_code="%s %s %s" % (left_code, c_operator, right_code),
+        emit=emit,
+        context=context,
+    )
+
+
+def decideCFloatUnaryOperation(to_name, expression, context):
+    if to_name.c_type not in ("double", "PyObject *"):
+        return False
+
+    if not _isCFloatOperation(expression):
+        return False
+
+    return to_name.c_type == "double" or _isCFloatValue(
+        expression.subnode_operand, context
+    )
+
+
+def generateCFloatUnaryOperationCode(to_name, expression, emit, context):
+    operand_code = _getCFloatOperandCode(expression.subnode_operand, emit, context)
+
+    _getCFloatResultCode(
+        to_name=to_name,
+        value_code="%s(%s)"
+        % (_cfloat_unary_operators[expression.getOperator()], operand_code),
+        emit=emit,
+        context=context,
+    )
+
+
+def decideCFloatComparison(to_name, comparator, left, right, context):
+    if comparator not in _cfloat_comparators:
+        return False
+
+    if to_name.c_type not in ("PyObject *", "nuitka_bool", "bool", "nuitka_void"):
+        return False
+
+    if not _isCFloatOperand(left) or not _isCFloatOperand(right):
+        return False
+
+    if left.getTypeShape() is not tshape_float:
+        if right.getTypeShape() is not tshape_float:
+            return False
+
+    return _isCFloatValue(left, context) or _isCFloatValue(right, context)
+
+
+def generateCFloatComparisonCode(to_name, comparator, left, right, emit, context):
+    left_code = _getCFloatOperandCode(left, emit, context)
+    right_code = _getCFloatOperandCode(right, emit, context)
+
+    to_name.getCType().emitAssignmentCodeFromBoolCondition(
+        to_name=to_name,
+        condition="%s %s %s" % (left_code, _cfloat_comparators[comparator], right_code),
+        emit=emit,
+    )
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -182,7 +182,10 @@ def getTypeSizeOf(type_indicator):
     elif type_indicator == "b":
         return "sizeof(nuitka_bool)"
     elif type_indicator == "L":
-        return "sizeof(nuitka_ilong)"
+        # Attached as an object.
+        return "sizeof(PyObject *)"
+    elif type_indicator == "f":
+        return "sizeof(double)"
     else:
         assert False, type_indicator
 
@@ -316,6 +319,7 @@ Py_CLEAR(%(frame_identifier)s->m_frame.f_locals);
             renderTemplateFromString(
                 template_frame_guard_normal_return_handler,
                 frame_identifier=frame_identifier,
+                frame_cache_identifier=frame_cache_identifier,
                 return_exit=parent_return_exit,
                 frame_return_exit=frame_return_exit,
                 needs_preserve=needs_preserve,
@@ -15,6 +15,7 @@ from .CodeHelpers import (
     generateStatementSequenceCode,
     withObjectCodeTemporaryAssignment,
 )
+from .ConstantCodes import getLazyConstantsLoadCode
 from .Contexts import PythonFunctionOutlineContext
 from .Emission import SourceCodeCollector
 from .ErrorCodes import getErrorExitCode, getMustNotGetHereCode, getReleaseCode
@@ -676,6 +677,10 @@ def _getFunctionCode(
             "function_cleanup": indented(function_cleanup)
         }
 
+    # Lazy constants used are unpacked on first execution.
+    function_entry_codes = SourceCodeCollector()
+    getLazyConstantsLoadCode(emit=function_entry_codes, context=context)
+
     if context.isForCreatedFunction():
         parameter_objects_decl = ["struct Nuitka_FunctionObject const *self"]
     else:
@@ -702,7 +707,9 @@ def _getFunctionCode(
             "function_identifier": function_identifier,
             "direct_call_arg_spec": ", ".join(parameter_objects_decl),
             "function_locals": indented(function_locals),
-            "function_body": indented(function_codes.codes),
+            "function_body": indented(
+                function_entry_codes.codes + function_codes.codes
+            ),
             "function_exit": function_exit,
         }
     else:
@@ -710,7 +717,9 @@ def _getFunctionCode(
             "function_identifier": function_identifier,
             "parameter_objects_decl": ", ".join(parameter_objects_decl),
             "function_locals": indented(function_locals),
-            "function_body": indented(function_codes.codes),
+            "function_body": indented(
+                function_entry_codes.codes + function_codes.codes
+            ),
             "function_exit": function_exit,
         }
 
@@ -8,6 +8,7 @@
 from nuitka.PythonVersions import python_version
 
 from .CodeHelpers import generateStatementSequenceCode
+from .ConstantCodes import getLazyConstantsLoadCode
 from .Emission import SourceCodeCollector
 from .FunctionCodes import (
     finalizeFunctionLocalVariables,
@@ -103,6 +104,10 @@ def getGeneratorObjectCode(
             "function_cleanup": indented(function_cleanup),
         }
 
+    # Lazy constants used are unpacked on first execution.
+    function_entry_codes = SourceCodeCollector()
+    getLazyConstantsLoadCode(emit=function_entry_codes, context=context)
+
     function_locals = context.variable_storage.makeCFunctionLevelDeclarations()
 
     local_type_decl = context.variable_storage.makeCStructLevelDeclarations()
@@ -129,7 +134,7 @@ struct %(function_identifier)s_locals *generator_heap = \
 
     return template_genfunc_yielder_body_template % {
         "function_identifier": function_identifier,
-        "function_body": indented(function_codes.codes),
+        "function_body": indented(function_entry_codes.codes + function_codes.codes),
         "heap_declaration": indented(heap_declaration),
         "has_heap_declaration": 1 if heap_declaration != "" else 0,
         "function_local_types": indented(local_type_decl),
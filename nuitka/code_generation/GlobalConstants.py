@@ -191,6 +191,7 @@ def getConstantDefaultPopulation():
     if python_version >= 0x390:
         result.append("as_file")
         result.append("register")
+        result.append("dispatch")
 
     if python_version >= 0x370:
         # New class method
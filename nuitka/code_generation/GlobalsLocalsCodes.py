@@ -118,8 +118,10 @@ def _getVariableDictUpdateCode(
 
     access_code = SourceCodeCollector()
 
+    value_name = VariableDeclaration("PyObject *", "value", None, None)
+
     getVariableReferenceCode(
-        to_name=VariableDeclaration("PyObject *", "value", None, None),
+        to_name=value_name,
         variable=variable,
         variable_trace=variable_trace,
         needs_check=False,
@@ -128,6 +130,15 @@ def _getVariableDictUpdateCode(
         context=context,
     )
 
+    # Values of C types that are boxed for this, are new references that the
+    # dictionary does not take.
+    if context.needsCleanup(value_name):
+        context.removeCleanupTempName(value_name)
+
+        release_code = indented("Py_DECREF(%s);" % value_name)
+    else:
+        release_code = ""
+
     if is_dict:
         if initial:
             template = template_set_locals_dict_value
@@ -141,6 +152,7 @@ def _getVariableDictUpdateCode(
                 "var_name": context.getConstantCode(constant=variable.getName()),
                 "test_code": test_code,
                 "access_code": indented(access_code.codes),
+                "release_code": release_code,
             }
         )
     else:
@@ -158,6 +170,7 @@ def _getVariableDictUpdateCode(
                 "var_name": context.getConstantCode(constant=variable.getName()),
                 "test_code": test_code,
                 "access_code": access_code,
+                "release_code": release_code,
                 "tmp_name": res_name,
             }
         )
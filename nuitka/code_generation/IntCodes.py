@@ -0,0 +1,116 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Int related codes, comparisons done on "int or long" values held in C.
+
+Values of loops over ranges are held as "nuitka_ilong" and are C "long"
+values most of the time. Comparing them with integer constants, should not
+require to create an object for them.
+"""
+
+from nuitka.__past__ import long
+
+from .VariableCodes import getLocalVariableDeclaration
+
+_cilong_comparators = {
+    "Lt": "<",
+    "LtE": "<=",
+    "Gt": ">",
+    "GtE": ">=",
+    "Eq": "==",
+    "NotEq": "!=",
+}
+
+# Constants must fit into C "long" on all platforms, which is only 32 bits
+# on Windows.
+_cilong_constant_limit = 2**31 - 1
+
+
+def _isCIntOrLongConstant(expression):
+    if not expression.isCompileTimeConstant():
+        return False
+
+    constant = expression.getCompileTimeConstant()
+
+    return (
+        type(constant) in (int, long)
+        and -_cilong_constant_limit <= constant <= _cilong_constant_limit
+    )
+
+
+def _getCIntOrLongVariableDeclaration(expression, context):
+    if not expression.isExpressionVariableRefOrTempVariableRef():
+        return None
+
+    variable = expression.getVariable()
+
+    if variable.isModuleVariable():
+        return None
+
+    variable_declaration = getLocalVariableDeclaration(
+        context, variable, expression.getVariableTrace()
+    )
+
+    if variable_declaration.c_type != "nuitka_ilong":
+        return None
+
+    return variable_declaration
+
+
+def decideCIntOrLongComparison(to_name, comparator, left, right, context):
+    if comparator not in _cilong_comparators:
+        return False
+
+    if to_name.c_type not in ("PyObject *", "nuitka_bool", "bool", "nuitka_void"):
+        return False
+
+    if _isCIntOrLongConstant(right):
+        return _getCIntOrLongVariableDeclaration(left, context) is not None
+    elif _isCIntOrLongConstant(left):
+        return _getCIntOrLongVariableDeclaration(right, context) is not None
+    else:
+        return False
+
+
+def generateCIntOrLongComparisonCode(to_name, comparator, left, right, emit, context):
+    variable_declaration = _getCIntOrLongVariableDeclaration(left, context)
+
+    if variable_declaration is not None:
+        constant = right.getCompileTimeConstant()
+        c_comparator = _cilong_comparators[comparator]
+    else:
+        variable_declaration = _getCIntOrLongVariableDeclaration(right, context)
+        constant = left.getCompileTimeConstant()
+
+        # Comparing with "0" keeps the order, so the comparator gets swapped.
+        c_comparator = _cilong_comparators[comparator]
+        c_comparator = {"<": ">", "<=": ">=", ">": "<", ">=": "<="}.get(
+            c_comparator, c_comparator
+        )
+
+    variable_declaration.getCType().emitValueAssertionCode(
+        value_name=variable_declaration, emit=emit
+    )
+
+    to_name.getCType().emitAssignmentCodeFromBoolCondition(
+        to_name=to_name,
+        condition="COMPARE_ILONG_CLONG(&%s, %dL) %s 0"
+        % (variable_declaration, constant, c_comparator),
+        emit=emit,
+    )
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
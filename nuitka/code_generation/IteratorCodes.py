@@ -27,9 +27,134 @@ from .Indentation import indented
 from .LineNumberCodes import getErrorLineNumberUpdateCode
 from .PythonAPICodes import generateCAPIObjectCode
 from .templates.CodeTemplatesIterators import template_loop_break_next
+from .VariableCodes import getLocalVariableDeclaration
+
+
+def getRangeLoopIteratorName(expression, context):
+    """Get the loop state, if "next" is used on a "for" loop over a range."""
+
+    if not expression.isExpressionTempVariableRef():
+        return None
+
+    variable_declaration = getLocalVariableDeclaration(
+        context, expression.getVariable(), expression.getVariableTrace()
+    )
+
+    if variable_declaration.c_type != "nuitka_range_iter":
+        return None
+
+    return variable_declaration
+
+
+def generateRangeLoopIteratorAssignmentCode(to_name, range_expression, emit, context):
+    range_name = context.allocateTempName("range_value")
+
+    generateExpressionCode(
+        to_name=range_name, expression=range_expression, emit=emit, context=context
+    )
+
+    res_name = context.getBoolResName()
+
+    emit(
+        "%s = MAKE_RANGE_LOOP_ITERATOR(tstate, &%s, %s);"
+        % (res_name, to_name, range_name)
+    )
+
+    getErrorExitBoolCode(
+        condition="%s == false" % res_name,
+        release_name=range_name,
+        emit=emit,
+        context=context,
+    )
+
+
+def _getRangeLoopNextCode(to_name, iterator_name, emit, context):
+    """Get the next value of a "for" loop over a range, return failure condition.
+
+    Values only become objects when they are used as such, unless an object
+    is requested here. Exhaustion is indicated without setting "StopIteration".
+    """
+
+    if to_name.c_type == "nuitka_ilong":
+        res_name = context.getBoolResName()
+
+        emit(
+            "%s = ITERATE_RANGE_LOOP_ILONG(&%s, &%s);"
+            % (res_name, iterator_name, to_name)
+        )
+
+        return "%s == false" % res_name
+    else:
+        assert to_name.c_type == "PyObject *", to_name
+
+        emit("%s = ITERATE_RANGE_LOOP(&%s);" % (to_name, iterator_name))
+
+        return "%s == NULL" % to_name
+
+
+def _getRangeLoopNext1Code(to_name, iterator_name, emit, context):
+    (
+        exception_state_name,
+        _exception_lineno,
+    ) = context.variable_storage.getExceptionVariableDescriptions()
+
+    condition = _getRangeLoopNextCode(
+        to_name=to_name,
+        iterator_name=iterator_name,
+        emit=emit,
+        context=context,
+    )
+
+    emit(
+        """\
+if (%(condition)s) {
+    FETCH_ERROR_OCCURRED_STATE(tstate, &%(exception_state_name)s);
+
+    if (!HAS_EXCEPTION_STATE(&%(exception_state_name)s)) {
+        SET_EXCEPTION_PRESERVATION_STATE_STOP_ITERATION_EMPTY(tstate, &%(exception_state_name)s);
+    }
+}
+"""
+        % {
+            "condition": condition,
+            "exception_state_name": exception_state_name,
+        }
+    )
+
+    getErrorExitBoolCode(
+        condition=condition,
+        fetched_exception=True,
+        emit=emit,
+        context=context,
+    )
+
+    context.addCleanupTempName(to_name)
 
 
 def generateBuiltinNext1Code(to_name, expression, emit, context):
+    iterator_name = getRangeLoopIteratorName(expression.subnode_value, context)
+
+    if iterator_name is not None:
+        if to_name.c_type == "nuitka_ilong":
+            _getRangeLoopNext1Code(
+                to_name=to_name,
+                iterator_name=iterator_name,
+                emit=emit,
+                context=context,
+            )
+        else:
+            with withObjectCodeTemporaryAssignment(
+                to_name, "next_value", expression, emit, context
+            ) as result_name:
+                _getRangeLoopNext1Code(
+                    to_name=result_name,
+                    iterator_name=iterator_name,
+                    emit=emit,
+                    context=context,
+                )
+
+        return
+
     (value_name,) = generateChildExpressionsCode(
         expression=expression, emit=emit, context=context
     )
@@ -78,6 +203,28 @@ def getBuiltinLoopBreakNextCode(to_name, value, emit, context):
 
     getReleaseCode(release_name=value, emit=emit, context=context)
 
+    _getLoopBreakNextCode(
+        to_name=to_name,
+        condition="%s == NULL" % to_name,
+        emit=emit,
+        context=context,
+    )
+
+
+def getRangeLoopBreakNextCode(to_name, iterator_name, emit, context):
+    condition = _getRangeLoopNextCode(
+        to_name=to_name,
+        iterator_name=iterator_name,
+        emit=emit,
+        context=context,
+    )
+
+    _getLoopBreakNextCode(
+        to_name=to_name, condition=condition, emit=emit, context=context
+    )
+
+
+def _getLoopBreakNextCode(to_name, condition, emit, context):
     break_target = context.getLoopBreakTarget()
     if type(break_target) is tuple:
         break_indicator_code = "%s = true;" % break_target[1]
@@ -93,7 +240,7 @@ def getBuiltinLoopBreakNextCode(to_name, value, emit, context):
     emit(
         template_loop_break_next
         % {
-            "to_name": to_name,
+            "condition": condition,
             "break_indicator_code": break_indicator_code,
             "break_target": break_target,
             "release_temps": indented(getErrorExitReleaseCode(context), 2),
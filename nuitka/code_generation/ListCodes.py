@@ -23,7 +23,6 @@ from .ErrorCodes import (
 )
 from .PythonAPICodes import (
     generateCAPIObjectCode,
-    generateCAPIObjectCode0,
     makeArgDescFromExpression,
 )
 from .SubscriptCodes import decideIntegerSubscript
@@ -458,7 +457,7 @@ def generateListOperationSort2Code(to_name, expression, emit, context):
 
 
 def generateListOperationSort3Code(to_name, expression, emit, context):
-    generateCAPIObjectCode0(
+    generateCAPIObjectCode(
         to_name=to_name,
         capi="LIST_SORT3",
         tstate=True,
@@ -20,11 +20,13 @@ needed except for technical reasons.
 import sys
 
 from nuitka import Options
+from nuitka.freezer.IncludedDataFiles import getEmbeddedDataFiles
 from nuitka.ModuleRegistry import (
     getDoneModules,
     getUncompiledModules,
     getUncompiledTechnicalModules,
 )
+from nuitka.pgo.PGO import getPGOModuleLoadOrder
 from nuitka.plugins.Plugins import Plugins
 from nuitka.PythonVersions import python_version
 from nuitka.Tracing import inclusion_logger
@@ -105,9 +107,53 @@ def getModuleMetaPathLoaderEntryCode(module, bytecode_accessor):
         }
 
 
+def getModuleNameHash(module_name):
+    """Hash of a module name for the loader index.
+
+    Note: Must match "Nuitka_HashModuleName" in "unfreezing.h" exactly, this
+    is a 32 bit FNV-1a of the UTF-8 encoded name.
+    """
+
+    result = 2166136261
+
+    for c in module_name.encode("utf8"):
+        if str is bytes:
+            c = ord(c)
+
+        result = ((result ^ c) * 16777619) & 0xFFFFFFFF
+
+    return result
+
+
+def _getMetaPathLoaderIndex(module_names):
+    """Open addressing hash table of entry positions, -1 for free slots.
+
+    It is kept at most half full, so probing the table ends quickly, even
+    for not found names, and the size is a power of two for masking.
+    """
+
+    index_size = 16
+    while index_size < 2 * len(module_names):
+        index_size *= 2
+
+    mask = index_size - 1
+    result = [-1] * index_size
+
+    for count, module_name in enumerate(module_names):
+        slot = getModuleNameHash(module_name) & mask
+
+        while result[slot] != -1:
+            slot = (slot + 1) & mask
+
+        result[slot] = count
+
+    return result
+
+
 def getMetaPathLoaderBodyCode(bytecode_accessor):
     metapath_loader_inittab = []
     metapath_module_decls = []
+    metapath_module_names = []
 
     uncompiled_modules = getUncompiledModules()
 
@@ -121,6 +167,7 @@ def getMetaPathLoaderBodyCode(bytecode_accessor):
                 module=other_module, bytecode_accessor=bytecode_accessor
             )
         )
+        metapath_module_names.append(other_module.getFullName().asString())
 
         if other_module.isCompiledPythonModule():
             metapath_module_decls.append(
@@ -137,6 +184,7 @@ PyThreadState *tstate, PyObject *, struct Nuitka_MetaPathBasedLoaderEntry const
                 module=uncompiled_module, bytecode_accessor=bytecode_accessor
             )
         )
+        metapath_module_names.append(uncompiled_module.getFullName().asString())
 
     frozen_defs = []
 
@@ -169,11 +217,65 @@ PyThreadState *tstate, PyObject *, struct Nuitka_MetaPathBasedLoaderEntry const
         if Options.isShowInclusion():
             inclusion_logger.info("Embedded as frozen module '%s'." % module_name)
 
+    embedded_data_files = []
+
+    for included_datafile in getEmbeddedDataFiles():
+        data = included_datafile.getFileContents()
+
+        name = included_datafile.dest_path
+        if str is not bytes:
+            name = name.encode("utf8")
+
+        accessor_code = bytecode_accessor.getBlobDataCode(
+            data=data,
+            name="data file '%s'" % included_datafile.dest_path,
+        )
+
+        embedded_data_files.append(
+            """\
+{{{name}, {start}, {size}}},""".format(
+                name=encodePythonStringToC(name),
+                start=accessor_code[accessor_code.find("[") + 1 : -1],
+                size=len(data),
+            )
+        )
+
+        if Options.isShowInclusion():
+            inclusion_logger.info(
+                "Embedded data file '%s' into binary." % included_datafile.dest_path
+            )
+
+    extension_modules_prefetch = []
+
+    if Options.isStandaloneMode() and not Options.shallMakeModule():
+        extension_module_names = [
+            other_module.getFullName().asString()
+            for other_module in getDoneModules()
+            if other_module.isPythonExtensionModule()
+        ]
+
+        for module_name in getPGOModuleLoadOrder(extension_module_names):
+            extension_modules_prefetch.append(
+                "%d," % metapath_module_names.index(module_name)
+            )
+
+    metapath_loader_index = _getMetaPathLoaderIndex(metapath_module_names)
+
     return template_metapath_loader_body % {
         "metapath_module_decls": indented(metapath_module_decls, 0),
         "metapath_loader_inittab": indented(metapath_loader_inittab),
+        "metapath_loader_index": indented(
+            [
+                ", ".join(str(index) for index in metapath_loader_index[i : i + 16])
+                + ","
+                for i in range(0, len(metapath_loader_index), 16)
+            ]
+        ),
+        "metapath_loader_index_size": len(metapath_loader_index),
         "bytecode_count": bytecode_accessor.getConstantsCount(),
         "frozen_modules": indented(frozen_defs),
+        "embedded_data_files": indented(embedded_data_files),
+        "extension_modules_prefetch": indented(extension_modules_prefetch),
     }
 
 
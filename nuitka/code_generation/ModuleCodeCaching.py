@@ -0,0 +1,420 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Caching of generated module code.
+
+The C code and constants data generated for a compiled module are kept, and
+used by later compilations, if nothing they depend on changed. That is the
+module source code, the Nuitka and Python versions, the options and plugins,
+and from other modules, the ones used by the module directly or indirectly,
+and the functions used across modules. Distributions looked at during
+compilation, e.g. for their version, also count with their metadata.
+
+Optimization still considers all modules, since for the whole program, the
+optimized trees are needed, but for unchanged modules, no code needs to be
+generated again.
+"""
+
+import os
+import sys
+import threading
+
+from nuitka import Options
+from nuitka.ModuleRegistry import getDoneModules
+from nuitka.OutputDirectories import getSourceDirectoryPath
+from nuitka.plugins.Plugins import Plugins
+from nuitka.Tracing import cache_logger
+from nuitka.utils.AppDirs import getCacheDir
+from nuitka.utils.Distributions import (
+    getDistribution,
+    getDistributionMetadataContents,
+    isValidDistributionName,
+)
+from nuitka.utils.FileOperations import (
+    getFileContents,
+    makePath,
+    putBinaryFileContents,
+    putTextFileContents,
+    replaceFileAtomic,
+)
+from nuitka.utils.Hashing import Hash, getStringHash
+from nuitka.utils.Json import loadJsonFromFilename, writeJsonToFilename
+from nuitka.Version import version_string
+
+from .CodeGeneration import (
+    addModuleCodeUsage,
+    generateModuleCode,
+    withModuleCodeUsageRecording,
+)
+
+# Bump this is format is changed or enhanced implementation might different ones.
+_cache_format_version = 3
+
+# Options that do not influence the generated code.
+_ignored_option_names = (
+    "output_dir",
+    "output_filename",
+    "remove_build",
+    "jobs",
+    "low_memory",
+    "clean_caches",
+    "disabled_caches",
+    "compilation_report_filename",
+    "quiet",
+    "show_scons",
+    "progress_bar",
+    "show_progress",
+    "show_memory",
+    "show_inclusion",
+    "show_inclusion_output",
+    "verbose",
+    "verbose_output",
+)
+
+
+def getModuleCodeCacheDir():
+    return getCacheDir("module-code")
+
+
+def _getCacheFilename(cache_name, extension):
+    return os.path.join(getModuleCodeCacheDir(), "%s.%s" % (cache_name, extension))
+
+
+def _shallUseModuleCodeCache():
+    # Python PGO information is not part of the cache key.
+    return not Options.shallDisableCodeCacheUsage() and not Options.isPythonPgoMode()
+
+
+_options_hash = None
+
+
+def _getOptionsHash():
+    # Singleton, pylint: disable=global-statement
+    global _options_hash
+
+    if _options_hash is None:
+        hash_value = Hash()
+
+        for option_name, option_value in sorted(vars(Options.options).items()):
+            if option_name not in _ignored_option_names:
+                hash_value.updateFromValues(option_name, repr(option_value))
+
+        _options_hash = hash_value.asHexDigest()
+
+    return _options_hash
+
+
+def _getModuleSourceCode(module):
+    # Namespace packages have no source code, only their name matters.
+    if module.isCompiledPythonNamespacePackage():
+        return ""
+
+    return module.getSourceCode()
+
+
+_module_signatures = None
+_done_modules = None
+
+
+def _getModuleSignature(module_name):
+    """Signature of a module as used by other modules, None if not included."""
+
+    # Singleton, pylint: disable=global-statement
+    global _module_signatures, _done_modules
+
+    if _module_signatures is None:
+        _module_signatures = {}
+        _done_modules = {}
+
+        for module in getDoneModules():
+            if module.isCompiledPythonModule():
+                signature = getStringHash(_getModuleSourceCode(module))
+            else:
+                signature = module.getFilename()
+
+            _module_signatures[module.getFullName()] = (module.kind, signature)
+            _done_modules[module.getFullName()] = module
+
+    return _module_signatures.get(module_name)
+
+
+def _getIndirectlyUsedModuleNames(module):
+    """Names of modules used by the modules the given one uses, and so on."""
+
+    # Make sure the done modules are known.
+    _getModuleSignature(module.getFullName())
+
+    result = set()
+    pending = [
+        module_usage_attempt.module_name
+        for module_usage_attempt in module.getUsedModules()
+    ]
+
+    while pending:
+        module_name = pending.pop()
+
+        if module_name in result or module_name == module.getFullName():
+            continue
+
+        result.add(module_name)
+
+        used_module = _done_modules.get(module_name)
+
+        if used_module is not None:
+            pending.extend(
+                module_usage_attempt.module_name
+                for module_usage_attempt in used_module.getUsedModules()
+            )
+
+    return result
+
+
+_distribution_signatures = {}
+
+
+def _getDistributionSignature(distribution_name):
+    """Signature of the installed distribution, None if not found."""
+
+    if distribution_name not in _distribution_signatures:
+        if isValidDistributionName(distribution_name):
+            distribution = getDistribution(distribution_name)
+        else:
+            distribution = None
+
+        if distribution is None:
+            signature = None
+        else:
+            signature = getStringHash(getDistributionMetadataContents(distribution))
+
+        _distribution_signatures[distribution_name] = signature
+
+    return _distribution_signatures[distribution_name]
+
+
+def _makeCacheName(module, data_filename):
+    module_name = module.getFullName()
+
+    hash_value = Hash()
+
+    hash_value.updateFromValues(
+        version_string,
+        sys.version,
+        _getOptionsHash(),
+        data_filename,
+        module.kind,
+        _getModuleSourceCode(module),
+    )
+
+    # Plugins may change their influence.
+    hash_value.updateFromValues(*Plugins.getCacheContributionValues(module_name))
+
+    # Other modules influence the code through the modules used and their
+    # contents, and functions used across modules.
+    for module_usage_attempt in module.getUsedModules():
+        hash_value.updateFromValues(
+            module_usage_attempt.module_name.asString(),
+            repr(module_usage_attempt.module_kind),
+            repr(module_usage_attempt.finding),
+            repr(_getModuleSignature(module_usage_attempt.module_name)),
+        )
+
+    # Values from other modules can reach the module also through the modules
+    # it uses, e.g. with trusted module variables.
+    indirect_module_names = _getIndirectlyUsedModuleNames(module)
+
+    for module_name_used in sorted(indirect_module_names):
+        hash_value.updateFromValues(
+            module_name_used.asString(),
+            repr(_getModuleSignature(module_name_used)),
+        )
+
+    # Distribution versions and metadata end up in the code as constants.
+    distribution_names = set(module.getUsedDistributions())
+
+    for module_name_used in indirect_module_names:
+        used_module = _done_modules.get(module_name_used)
+
+        if used_module is not None:
+            distribution_names.update(used_module.getUsedDistributions())
+
+    for distribution_name in sorted(distribution_names):
+        hash_value.updateFromValues(
+            distribution_name, repr(_getDistributionSignature(distribution_name))
+        )
+
+    for function_body in module.getUsedFunctions():
+        # Only normal functions can be used by other modules.
+        hash_value.updateFromValues(
+            function_body.getCodeName(),
+            repr(
+                function_body.isExpressionFunctionBody()
+                and function_body.isCrossModuleUsed()
+            ),
+        )
+
+    for function_body in module.getCrossUsedFunctions():
+        hash_value.updateFromValues(function_body.getCodeName())
+
+    return module_name.asString() + "@" + hash_value.asHexDigest()
+
+
+def _getCachedModuleCode(cache_name, module_name, data_filename):
+    cache_filename = _getCacheFilename(cache_name, "json")
+
+    if not os.path.exists(cache_filename):
+        return None
+
+    data = loadJsonFromFilename(cache_filename)
+
+    if data is None:
+        return None
+
+    if data.get("file_format_version") != _cache_format_version:
+        return None
+
+    if data["module_name"] != module_name:
+        return None
+
+    c_cache_filename = _getCacheFilename(cache_name, "c")
+    const_cache_filename = _getCacheFilename(cache_name, "const")
+
+    if not os.path.exists(c_cache_filename) or not os.path.exists(
+        const_cache_filename
+    ):
+        return None
+
+    putBinaryFileContents(
+        filename=os.path.join(getSourceDirectoryPath(), data_filename),
+        contents=getFileContents(const_cache_filename, mode="rb"),
+    )
+
+    addModuleCodeUsage(data["usage"])
+
+    return getFileContents(c_cache_filename, encoding="latin1")
+
+
+def _getCacheTempFilename(cache_filename):
+    # Other processes might use the cache too, only complete files are to be
+    # seen, so they are written to a unique name first and then replaced.
+    return "%s.%d.%d.tmp" % (
+        cache_filename,
+        os.getpid(),
+        threading.current_thread().ident,
+    )
+
+
+def _writeModuleCodeToCache(
+    cache_name, module_name, data_filename, source_code, usage
+):
+    makePath(getModuleCodeCacheDir())
+
+    c_cache_filename = _getCacheFilename(cache_name, "c")
+    c_cache_tmp_filename = _getCacheTempFilename(c_cache_filename)
+
+    putTextFileContents(
+        filename=c_cache_tmp_filename,
+        contents=source_code,
+        encoding="latin1",
+    )
+    replaceFileAtomic(c_cache_tmp_filename, c_cache_filename)
+
+    const_cache_filename = _getCacheFilename(cache_name, "const")
+    const_cache_tmp_filename = _getCacheTempFilename(const_cache_filename)
+
+    putBinaryFileContents(
+        filename=const_cache_tmp_filename,
+        contents=getFileContents(
+            os.path.join(getSourceDirectoryPath(), data_filename), mode="rb"
+        ),
+    )
+    replaceFileAtomic(const_cache_tmp_filename, const_cache_filename)
+
+    # Written last, only with this, the other files are considered.
+    json_cache_filename = _getCacheFilename(cache_name, "json")
+    json_cache_tmp_filename = _getCacheTempFilename(json_cache_filename)
+
+    writeJsonToFilename(
+        filename=json_cache_tmp_filename,
+        contents={
+            "file_format_version": _cache_format_version,
+            "module_name": module_name,
+            "usage": usage,
+        },
+    )
+    replaceFileAtomic(json_cache_tmp_filename, json_cache_filename)
+
+
+_cached_modules_count = 0
+
+
+def generateModuleCodeCached(module, data_filename):
+    """Generate the code for a module, or take it from the cache.
+
+    The constants data file is created either way.
+    """
+
+    # Singleton, pylint: disable=global-statement
+    global _cached_modules_count
+
+    if not _shallUseModuleCodeCache():
+        return generateModuleCode(module=module, data_filename=data_filename)
+
+    module_name = module.getFullName().asString()
+    cache_name = _makeCacheName(module=module, data_filename=data_filename)
+
+    source_code = _getCachedModuleCode(
+        cache_name=cache_name, module_name=module_name, data_filename=data_filename
+    )
+
+    if source_code is not None:
+        _cached_modules_count += 1
+
+        return source_code
+
+    with withModuleCodeUsageRecording() as usage:
+        source_code = generateModuleCode(module=module, data_filename=data_filename)
+
+    _writeModuleCodeToCache(
+        cache_name=cache_name,
+        module_name=module_name,
+        data_filename=data_filename,
+        source_code=source_code,
+        usage=usage,
+    )
+
+    return source_code
+
+
+def getCachedModulesCount():
+    return _cached_modules_count
+
+
+def addCachedModulesCount(count):
+    # Singleton, pylint: disable=global-statement
+    global _cached_modules_count
+
+    _cached_modules_count += count
+
+
+def reportModuleCodeCacheUsage(modules_count):
+    if _cached_modules_count:
+        cache_logger.info(
+            "Used cached code for %d of %d compiled modules."
+            % (_cached_modules_count, modules_count)
+        )
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -17,6 +17,7 @@ from .CodeHelpers import (
     withObjectCodeTemporaryAssignment,
 )
 from .CodeObjectCodes import getCodeObjectsDeclCode, getCodeObjectsInitCode
+from .ConstantCodes import getLazyConstantsLoadCode
 from .Indentation import indented
 from .templates.CodeTemplatesModules import (
     template_global_copyright,
@@ -116,6 +117,13 @@ def getModuleCode(
         module.getRuntimePackageValue() if is_dunder_main else ""
     )
 
+    # Lazy constants used by the module code itself are unpacked with the
+    # other module constants.
+    module_lazy_constants_load = Emission.SourceCodeCollector()
+    getLazyConstantsLoadCode(emit=module_lazy_constants_load, context=context)
+
+    lazy_constants_count = context.getLazyConstantsCount()
+
     if str is bytes:
         module_dll_entry_point = "init" + module_identifier
         module_def_size = -1
@@ -154,6 +162,11 @@ def getModuleCode(
         "module_code_objects_decl": indented(module_code_objects_decl, 0),
         "module_code_objects_init": indented(module_code_objects_init),
         "constants_count": context.getConstantsCount(),
+        "lazy_constants_count": lazy_constants_count,
+        "lazy_constants_output": (
+            "&mod_consts_lazy[0]" if lazy_constants_count else "NULL"
+        ),
+        "module_lazy_constants_load": indented(module_lazy_constants_load.codes, 8),
         "module_const_blob_name": module_const_blob_name,
         "module_dll_entry_point": module_dll_entry_point,
         "module_def_size": module_def_size,
@@ -33,6 +33,18 @@ from .ErrorCodes import (
     getTakeReferenceCode,
 )
 from .ExpressionCTypeSelectionHelpers import decideExpressionCTypes
+from .FloatCodes import (
+    decideCFloatBinaryOperation,
+    decideCFloatUnaryOperation,
+    generateCFloatBinaryOperationCode,
+    generateCFloatUnaryOperationCode,
+)
+from .PythonPgoCodes import (
+    getPythonPgoGuardedHelperCallCode,
+    getPythonPgoSiteName,
+    getPythonPgoTypeTraceCode,
+    selectPythonPgoCodeHelper,
+)
 
 
 def generateOperationBinaryCode(to_name, expression, emit, context):
@@ -73,6 +85,14 @@ def generateOperationNotCode(to_name, expression, emit, context):
 
 
 def generateOperationUnaryCode(to_name, expression, emit, context):
+    if decideCFloatUnaryOperation(
+        to_name=to_name, expression=expression, context=context
+    ):
+        generateCFloatUnaryOperationCode(
+            to_name=to_name, expression=expression, emit=emit, context=context
+        )
+        return
+
     (arg_name,) = generateChildExpressionsCode(
         expression=expression, emit=emit, context=context
     )
@@ -94,6 +114,19 @@ def _getBinaryOperationCode(
     # This is detail rich stuff, encoding the complexity of what helpers are
     # available, and can be used as a fallback.
     # pylint: disable=too-many-branches,too-many-locals,too-many-statements
+    if decideCFloatBinaryOperation(
+        to_name=to_name, operator=operator, left=left, right=right, context=context
+    ):
+        generateCFloatBinaryOperationCode(
+            to_name=to_name,
+            operator=operator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+        return
+
     (
         _unknown_types,
         needs_argument_swap,
@@ -267,15 +300,48 @@ def _getBinaryOperationCode(
         else:
             value_name = to_name
 
-        emit(
-            "%s = %s(%s, %s);"
-            % (
-                value_name,
-                helper_function,
-                arg1_name,
-                arg2_name,
+        # Generic helpers only, let Python PGO find what types are used, and
+        # provide a fast path for them.
+        if helper_function.endswith("_OBJECT_OBJECT"):
+            pgo_site_name = getPythonPgoSiteName(operator, source_ref)
+
+            getPythonPgoTypeTraceCode(
+                site_name=pgo_site_name,
+                operand1_name=arg1_name,
+                operand2_name=arg2_name,
+                emit=emit,
+                context=context,
+            )
+
+            pgo_helper = selectPythonPgoCodeHelper(
+                prefix=prefix,
+                specialized_helpers_set=specialized_helpers_set,
+                result_type=helper_type,
+                site_name=pgo_site_name,
+                context=context,
+            )
+        else:
+            pgo_helper = None
+
+        if pgo_helper is not None:
+            getPythonPgoGuardedHelperCallCode(
+                value_name=value_name,
+                helper_function=helper_function,
+                pgo_helper=pgo_helper,
+                arg1_name=arg1_name,
+                arg2_name=arg2_name,
+                emit=emit,
+            )
+        else:
+            emit(
+                "%s = %s(%s, %s);"
+                % (
+                    value_name,
+                    helper_function,
+                    arg1_name,
+                    arg2_name,
+                )
             )
-        )
 
         if value_name.getCType().hasErrorIndicator():
             getErrorExitCode(
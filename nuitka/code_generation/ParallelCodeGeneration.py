@@ -0,0 +1,118 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Code generation of modules in worker processes.
+
+The code of each module is generated independently, except for what it needs
+from the helpers code, that is created once for all modules, i.e. the quick
+call helpers and the constants. The workers record that usage for every module
+and send it to the main process together with the code, where it gets merged
+for the creation of the helpers code.
+"""
+
+from nuitka import Options
+from nuitka.Tracing import progress_logger
+from nuitka.utils.WorkerProcesses import (
+    distributeWorkItems,
+    isWorkerProcessSupported,
+    receiveWorkerResults,
+    startWorkerProcess,
+)
+
+from .CodeGeneration import addModuleCodeUsage, withModuleCodeUsageRecording
+from .ModuleCodeCaching import (
+    addCachedModulesCount,
+    generateModuleCodeCached,
+    getCachedModulesCount,
+)
+
+
+def shallUseCodeGenerationWorkers(modules):
+    return (
+        Options.getCodeGenerationJobLimit() > 1
+        and len(modules) > 1
+        and isWorkerProcessSupported()
+        # Reports of missing helpers are only collected in the main process.
+        and not Options.is_report_missing
+    )
+
+
+def _generateModulesCodeInWorker(connection, modules, module_data_filenames):
+    for module in modules:
+        cached_modules_count = getCachedModulesCount()
+
+        with withModuleCodeUsageRecording() as usage:
+            source_code = generateModuleCodeCached(
+                module=module, data_filename=module_data_filenames[module]
+            )
+
+        connection.send(
+            (
+                module_data_filenames[module],
+                source_code,
+                usage,
+                getCachedModulesCount() - cached_modules_count,
+            )
+        )
+
+
+def generateModulesCodeInWorkers(modules, module_data_filenames, on_module_code):
+    """Generate code for the modules in workers.
+
+    The constants data files are written by the workers, the code is given to
+    "on_module_code" with the module. Returns the modules that a worker failed
+    for, these need to be done in the main process.
+    """
+
+    job_count = min(Options.getCodeGenerationJobLimit(), len(modules))
+
+    progress_logger.info(
+        "Generating code for %d modules in %d worker processes."
+        % (len(modules), job_count)
+    )
+
+    modules_by_data_filename = dict(
+        (module_data_filenames[module], module) for module in modules
+    )
+
+    workers = [
+        startWorkerProcess(
+            _generateModulesCodeInWorker, job_modules, module_data_filenames
+        )
+        for job_modules in distributeWorkItems(
+            items=modules,
+            job_count=job_count,
+            # Functions are where most of the code is.
+            get_size=lambda module: len(module.getUsedFunctions()) + 1,
+        )
+    ]
+
+    for data_filename, source_code, usage, cached_modules_count in (
+        receiveWorkerResults(workers)
+    ):
+        addModuleCodeUsage(usage)
+        addCachedModulesCount(cached_modules_count)
+
+        on_module_code(modules_by_data_filename.pop(data_filename), source_code)
+
+    return [
+        module
+        for module in modules
+        if module_data_filenames[module] in modules_by_data_filename
+    ]
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -0,0 +1,187 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Codes for Python level PGO type feedback.
+
+When creating Python PGO information, operation sites get probes that record
+the types of their operands. When using it, hot sites with a dominant type
+combination get a type guarded fast path, that uses the specialized helper
+for these types, and otherwise the generic one.
+"""
+
+from nuitka import Options
+from nuitka.nodes.shapes.BuiltinTypeShapes import (
+    tshape_bytes,
+    tshape_float,
+    tshape_int,
+    tshape_list,
+    tshape_long,
+    tshape_str,
+    tshape_tuple,
+    tshape_unicode,
+)
+from nuitka.pgo.PGO import getPGOTypeTrace
+from nuitka.PythonVersions import python_version
+
+from .c_types.CTypeBooleans import CTypeBool
+from .c_types.CTypeNuitkaBooleans import CTypeNuitkaBoolEnum
+from .c_types.CTypePyObjectPointers import CTypePyObjectPtr
+from .CodeHelperSelection import selectCodeHelper
+
+# Type names as observed at run time, to the shape and the exact type object to
+# check for at run time.
+if python_version < 0x300:
+    _pgo_type_shapes = {
+        "int": (tshape_int, "&PyInt_Type"),
+        "long": (tshape_long, "&PyLong_Type"),
+        "float": (tshape_float, "&PyFloat_Type"),
+        "str": (tshape_str, "&PyString_Type"),
+        "unicode": (tshape_unicode, "&PyUnicode_Type"),
+        "list": (tshape_list, "&PyList_Type"),
+        "tuple": (tshape_tuple, "&PyTuple_Type"),
+    }
+else:
+    _pgo_type_shapes = {
+        "int": (tshape_int, "&PyLong_Type"),
+        "float": (tshape_float, "&PyFloat_Type"),
+        "str": (tshape_str, "&PyUnicode_Type"),
+        "bytes": (tshape_bytes, "&PyBytes_Type"),
+        "list": (tshape_list, "&PyList_Type"),
+        "tuple": (tshape_tuple, "&PyTuple_Type"),
+    }
+
+
+def getPythonPgoSiteName(kind, source_ref):
+    column = source_ref.getColumnNumber()
+
+    if column is None:
+        return "%s:%d" % (kind, source_ref.getLineNumber())
+    else:
+        return "%s:%d:%d" % (kind, source_ref.getLineNumber(), column)
+
+
+def getPythonPgoTypeTraceCode(site_name, operand1_name, operand2_name, emit, context):
+    if not Options.shallCreatePythonPgoInput():
+        return
+
+    emit(
+        'PGO_onTypeTraced("%s", "%s", %s, %s);'
+        % (
+            context.getModuleName().asString(),
+            site_name,
+            operand1_name,
+            operand2_name if operand2_name is not None else "NULL",
+        )
+    )
+
+
+def selectPythonPgoCodeHelper(
+    prefix, specialized_helpers_set, result_type, site_name, context
+):
+    """Select a specialized helper for the types observed at a site.
+
+    Returns the helper type, helper function, and type objects to check
+    the two operands against, or None if there is nothing usable.
+    """
+
+    type_names = getPGOTypeTrace(
+        module_name=context.getModuleName().asString(), site_name=site_name
+    )
+
+    if type_names is None:
+        return None
+
+    left_type_name, right_type_name = type_names
+
+    if left_type_name not in _pgo_type_shapes:
+        return None
+    if right_type_name not in _pgo_type_shapes:
+        return None
+
+    left_shape, left_type_object = _pgo_type_shapes[left_type_name]
+    right_shape, right_type_object = _pgo_type_shapes[right_type_name]
+
+    helper_type, helper_function = selectCodeHelper(
+        prefix=prefix,
+        specialized_helpers_set=specialized_helpers_set,
+        non_specialized_helpers_set=(),
+        result_type=result_type,
+        left_shape=left_shape,
+        right_shape=right_shape,
+        left_c_type=CTypePyObjectPtr,
+        right_c_type=CTypePyObjectPtr,
+        argument_swap=False,
+        report_missing=False,
+        source_ref=None,
+    )
+
+    # Non-raising specializations often only exist as C bool variants, these
+    # can be converted.
+    if helper_function is None and result_type is CTypeNuitkaBoolEnum:
+        helper_type, helper_function = selectCodeHelper(
+            prefix=prefix,
+            specialized_helpers_set=specialized_helpers_set,
+            non_specialized_helpers_set=(),
+            result_type=CTypeBool,
+            left_shape=left_shape,
+            right_shape=right_shape,
+            left_c_type=CTypePyObjectPtr,
+            right_c_type=CTypePyObjectPtr,
+            argument_swap=False,
+            report_missing=False,
+            source_ref=None,
+        )
+
+    if helper_function is None:
+        return None
+
+    return helper_type, helper_function, left_type_object, right_type_object
+
+
+def getPythonPgoGuardedHelperCallCode(
+    value_name, helper_function, pgo_helper, arg1_name, arg2_name, emit
+):
+    pgo_helper_type, pgo_helper_function, left_type_object, right_type_object = (
+        pgo_helper
+    )
+
+    pgo_helper_call = "%s(%s, %s)" % (pgo_helper_function, arg1_name, arg2_name)
+
+    if pgo_helper_type is not value_name.getCType():
+        assert pgo_helper_type is CTypeBool, pgo_helper_type
+
+        pgo_helper_call = "%s ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE" % pgo_helper_call
+
+    emit(
+        """\
+if (Py_TYPE(%(arg1_name)s) == %(left_type_object)s && Py_TYPE(%(arg2_name)s) == %(right_type_object)s) {
+    %(value_name)s = %(pgo_helper_call)s;
+} else {
+    %(value_name)s = %(helper_function)s(%(arg1_name)s, %(arg2_name)s);
+}"""
+        % {
+            "value_name": value_name,
+            "helper_function": helper_function,
+            "pgo_helper_call": pgo_helper_call,
+            "arg1_name": arg1_name,
+            "arg2_name": arg2_name,
+            "left_type_object": left_type_object,
+            "right_type_object": right_type_object,
+        }
+    )
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
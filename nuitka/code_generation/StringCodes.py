@@ -10,12 +10,12 @@ from nuitka.PythonVersions import python_version
 from .CallCodes import getCallCodePosVariableKeywordVariableArgs
 from .CodeHelpers import (
     decideConversionCheckNeeded,
+    generateChildExpressionsCode,
     generateExpressionCode,
     withObjectCodeTemporaryAssignment,
 )
 from .ErrorCodes import getErrorExitCode
 from .PythonAPICodes import generateCAPIObjectCode, makeArgDescFromExpression
-from .TupleCodes import getTupleCreationCode
 
 
 def generateBuiltinBytes1Code(to_name, expression, emit, context):
@@ -143,27 +143,30 @@ def generateBuiltinOrdCode(to_name, expression, emit, context):
 
 
 def generateStringConcatenationCode(to_name, expression, emit, context):
-    values = expression.subnode_values
+    (value_names,) = generateChildExpressionsCode(
+        expression=expression, emit=emit, context=context
+    )
 
     with withObjectCodeTemporaryAssignment(
         to_name, "string_concat_result", expression, emit, context
     ) as value_name:
-        tuple_temp_name = context.allocateTempName("string_concat_values")
-
-        # TODO: Consider using _PyUnicode_JoinArray which avoids the tuple,
-        # but got all to be able to release arrays.
-        getTupleCreationCode(
-            to_name=tuple_temp_name, elements=values, emit=emit, context=context
-        )
-
+        # The values are given as an array, avoiding the creation of a tuple.
         emit(
-            "%s = PyUnicode_Join(%s, %s);"
-            % (value_name, context.getConstantCode(""), tuple_temp_name)
+            """\
+{
+    PyObject *string_concat_values[] = {%s};
+    %s = UNICODE_JOIN_ARRAY(tstate, string_concat_values, %d);
+}"""
+            % (
+                ", ".join(str(element_name) for element_name in value_names),
+                value_name,
+                len(value_names),
+            )
         )
 
         getErrorExitCode(
             check_name=value_name,
-            release_name=tuple_temp_name,
+            release_names=value_names,
             emit=emit,
             context=context,
         )
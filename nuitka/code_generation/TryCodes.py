@@ -13,9 +13,13 @@ from nuitka import Options
 from .CodeHelpers import generateExpressionCode, generateStatementSequenceCode
 from .ErrorCodes import getMustNotGetHereCode
 from .ExceptionCodes import getExceptionUnpublishedReleaseCode
-from .IteratorCodes import getBuiltinLoopBreakNextCode
+from .IteratorCodes import (
+    getBuiltinLoopBreakNextCode,
+    getRangeLoopBreakNextCode,
+    getRangeLoopIteratorName,
+)
 from .LabelCodes import getGotoCode, getLabelCode
-from .VariableCodes import getVariableAssignmentCode
+from .VariableCodes import getLocalVariableDeclaration, getVariableAssignmentCode
 
 
 def generateTryCode(statement, emit, context):
@@ -270,30 +274,54 @@ def generateTryNextExceptStopIterationCode(statement, emit, context):
     if not no_statements[0].isStatementReraiseException():
         return False
 
-    tmp_name = context.allocateTempName("next_source")
+    variable = tried_statement.getVariable()
+    variable_trace = tried_statement.getVariableTrace()
+
+    iterator_name = getRangeLoopIteratorName(assign_source.subnode_value, context)
+
+    if iterator_name is not None:
+        # Loops over ranges may produce the values in C only.
+        if (
+            not variable.isModuleVariable()
+            and getLocalVariableDeclaration(context, variable, variable_trace).c_type
+            == "nuitka_ilong"
+        ):
+            tmp_name2 = context.allocateTempName("assign_source", "nuitka_ilong")
+        else:
+            tmp_name2 = context.allocateTempName("assign_source")
+    else:
+        tmp_name = context.allocateTempName("next_source")
 
-    generateExpressionCode(
-        expression=assign_source.subnode_value,
-        to_name=tmp_name,
-        emit=emit,
-        context=context,
-    )
+        generateExpressionCode(
+            expression=assign_source.subnode_value,
+            to_name=tmp_name,
+            emit=emit,
+            context=context,
+        )
 
-    tmp_name2 = context.allocateTempName("assign_source")
+        tmp_name2 = context.allocateTempName("assign_source")
 
     with context.withCurrentSourceCodeReference(
         assign_source.getSourceReference()
         if Options.is_full_compat
         else statement.getSourceReference()
     ):
-        getBuiltinLoopBreakNextCode(
-            to_name=tmp_name2, value=tmp_name, emit=emit, context=context
-        )
+        if iterator_name is not None:
+            getRangeLoopBreakNextCode(
+                to_name=tmp_name2,
+                iterator_name=iterator_name,
+                emit=emit,
+                context=context,
+            )
+        else:
+            getBuiltinLoopBreakNextCode(
+                to_name=tmp_name2, value=tmp_name, emit=emit, context=context
+            )
 
         getVariableAssignmentCode(
             tmp_name=tmp_name2,
-            variable=tried_statement.getVariable(),
-            variable_trace=tried_statement.getVariableTrace(),
+            variable=variable,
+            variable_trace=variable_trace,
             needs_release=None,
             inplace=False,
             emit=emit,
@@ -7,11 +7,17 @@
 
 from nuitka.nodes.shapes.BuiltinTypeShapes import (
     tshape_bool,
+    tshape_float,
     tshape_int_or_long,
+    tshape_xrange,
 )
 from nuitka.PythonVersions import python_version
+from nuitka.tree.Extractions import getVariableReads
 
+from .c_types.CTypeCFloats import CTypeCFloat
 from .c_types.CTypeNuitkaBooleans import CTypeNuitkaBoolEnum
+from .c_types.CTypeNuitkaInts import CTypeNuitkaIntOrLongStruct
+from .c_types.CTypeNuitkaRangeIterators import CTypeNuitkaRangeIterator
 from .c_types.CTypePyObjectPointers import (
     CTypeCellObject,
     CTypePyObjectPtr,
@@ -28,6 +34,7 @@ from .ErrorCodes import (
     getLocalVariableReferenceErrorCode,
     getNameReferenceErrorCode,
 )
+from .templates.CodeTemplatesVariables import template_read_mvar_cached
 from .VariableDeclarations import VariableDeclaration
 
 
@@ -47,6 +54,16 @@ def generateAssignmentVariableCode(statement, emit, context):
             context, variable, variable_trace
         )
 
+        if variable_declaration.c_type == "nuitka_range_iter":
+            _generateRangeLoopIteratorAssignmentCode(
+                to_name=variable_declaration,
+                range_expression=assign_source.subnode_value,
+                emit=emit,
+                context=context,
+            )
+
+            return
+
         if source_shape is tshape_bool and variable_declaration.c_type == "nuitka_bool":
             tmp_name = context.allocateTempName("assign_source", "nuitka_bool")
         elif (
@@ -54,6 +71,15 @@ def generateAssignmentVariableCode(statement, emit, context):
             and variable_declaration.c_type == "nuitka_ilong"
         ):
             tmp_name = context.allocateTempName("assign_source", "nuitka_ilong")
+        elif variable_declaration.c_type == "nuitka_ilong" and (
+            isRangeLoopValueSource(assign_source)
+            or _isCIntOrLongVariableRef(assign_source, context)
+        ):
+            tmp_name = context.allocateTempName("assign_source", "nuitka_ilong")
+        elif variable_declaration.c_type == "double" and _isCFloatAssignmentSource(
+            assign_source, context
+        ):
+            tmp_name = context.allocateTempName("assign_source", "double")
         else:
             tmp_name = context.allocateTempName("assign_source")
 
@@ -101,27 +127,42 @@ def getVariableReferenceCode(
             # TODO: Rather have this passed from a distinct node type, so inlining
             # doesn't change things.
 
-            emit(
-                """\
+            if 0x360 <= python_version < 0x3C0:
+                emit(
+                    template_read_mvar_cached
+                    % {
+                        "module_identifier": context.getModuleCodeName(),
+                        "value_name": value_name,
+                        "var_name": context.getConstantCode(
+                            constant=variable.getName()
+                        ),
+                        "cache_name": context.variable_storage.addModuleValueCacheDeclaration(),
+                    }
+                )
+            else:
+                emit(
+                    """\
 %(value_name)s = GET_STRING_DICT_VALUE(moduledict_%(module_identifier)s, (Nuitka_StringObject *)%(var_name)s);
 
 if (unlikely(%(value_name)s == NULL)) {
     %(value_name)s = %(helper_code)s(tstate, %(var_name)s);
 }
 """
-                % {
-                    "helper_code": (
-                        "GET_MODULE_VARIABLE_VALUE_FALLBACK_IN_FUNCTION"
-                        if python_version < 0x340
-                        and not owner.isCompiledPythonModule()
-                        and not owner.isExpressionClassBodyBase()
-                        else "GET_MODULE_VARIABLE_VALUE_FALLBACK"
-                    ),
-                    "module_identifier": context.getModuleCodeName(),
-                    "value_name": value_name,
-                    "var_name": context.getConstantCode(constant=variable.getName()),
-                }
-            )
+                    % {
+                        "helper_code": (
+                            "GET_MODULE_VARIABLE_VALUE_FALLBACK_IN_FUNCTION"
+                            if python_version < 0x340
+                            and not owner.isCompiledPythonModule()
+                            and not owner.isExpressionClassBodyBase()
+                            else "GET_MODULE_VARIABLE_VALUE_FALLBACK"
+                        ),
+                        "module_identifier": context.getModuleCodeName(),
+                        "value_name": value_name,
+                        "var_name": context.getConstantCode(
+                            constant=variable.getName()
+                        ),
+                    }
+                )
 
             getErrorExitCode(
                 check_name=value_name,
@@ -189,6 +230,185 @@ def _getVariableCodeName(in_context, variable):
         return "var_" + variable.getCodeName()
 
 
+def _isCFloatAssignmentSource(expression, context):
+    # Avoid cyclic imports, float codes use variable declarations.
+    from .FloatCodes import isCFloatAssignmentSource
+
+    return isCFloatAssignmentSource(expression, context)
+
+
+def _isCIntOrLongVariableRef(expression, context):
+    if not expression.isExpressionVariableRefOrTempVariableRef():
+        return False
+
+    variable = expression.getVariable()
+
+    if variable.isModuleVariable():
+        return False
+
+    variable_declaration = getLocalVariableDeclaration(
+        context, variable, expression.getVariableTrace()
+    )
+
+    return variable_declaration.c_type == "nuitka_ilong"
+
+
+def _generateRangeLoopIteratorAssignmentCode(to_name, range_expression, emit, context):
+    # Avoid cyclic imports, iterator codes use variable declarations.
+    from .IteratorCodes import generateRangeLoopIteratorAssignmentCode
+
+    generateRangeLoopIteratorAssignmentCode(
+        to_name=to_name, range_expression=range_expression, emit=emit, context=context
+    )
+
+
+def _mustHaveValue(variable_trace, seen):
+    if variable_trace is None:
+        return False
+
+    # Loops and merges refer to themselves, but only the values flowing into
+    # them from outside matter.
+    if variable_trace.isMergeTrace() or variable_trace.isLoopTrace():
+        if variable_trace in seen:
+            return True
+
+        seen.add(variable_trace)
+
+        return all(
+            _mustHaveValue(previous, seen) for previous in variable_trace.previous
+        )
+
+    if variable_trace.isEscapeTrace():
+        return _mustHaveValue(variable_trace.previous, seen)
+
+    return variable_trace.mustHaveValue()
+
+
+# Cache of the variable reads of the last function asked for.
+_variable_reads_cache = [None, None]
+
+
+def _getVariableReads(entry_point):
+    if _variable_reads_cache[0] is not entry_point:
+        _variable_reads_cache[0] = entry_point
+        _variable_reads_cache[1] = getVariableReads(entry_point)
+
+    return _variable_reads_cache[1]
+
+
+def _isProvenAssignedVariable(variable):
+    """Decide if a variable is never deleted, and assigned whenever read.
+
+    Only these can use C types that have no way to represent an unassigned
+    value, or where deleting is not implemented.
+    """
+
+    if variable.hasDeletedTraces():
+        return False
+
+    seen = set()
+
+    for _node, variable_trace in _getVariableReads(variable.getEntryPoint()).get(
+        variable, ()
+    ):
+        if not _mustHaveValue(variable_trace, seen):
+            return False
+
+    return True
+
+
+def _canUseCFloat(variable):
+    """Decide if a variable that only holds floats, can be a C double."""
+
+    if not variable.isLocalVariable() or variable.isParameterVariable():
+        return False
+
+    return _isProvenAssignedVariable(variable)
+
+
+def _isRangeLoopIteratorVariable(variable):
+    """Decide if a variable is the iterator of a "for" loop over a range.
+
+    These are only assigned from "iter" of a range, and only read by "next",
+    so the loop can be done in C, see "CTypeNuitkaRangeIterator".
+    """
+
+    if not variable.isTempVariable() or variable.isSharedTechnically():
+        return False
+
+    # Generator expressions get the iterator passed from the outside.
+    if variable.hasAccessesOutsideOf(variable.getOwner()) is not False:
+        return False
+
+    assign_nodes = variable.getAssignNodes()
+
+    if not assign_nodes:
+        return False
+
+    for assign_node in assign_nodes:
+        source = assign_node.subnode_source
+
+        if not source.isExpressionBuiltinIter1():
+            return False
+
+        if source.subnode_value.getTypeShape() is not tshape_xrange:
+            return False
+
+    for node, _variable_trace in _getVariableReads(variable.getEntryPoint()).get(
+        variable, ()
+    ):
+        if not node.isExpressionTempVariableRef():
+            return False
+
+        if not node.getParent().isExpressionBuiltinNext1():
+            return False
+
+    return _isProvenAssignedVariable(variable)
+
+
+def isRangeLoopValueSource(expression):
+    return (
+        expression.isExpressionBuiltinNext1()
+        and expression.subnode_value.isExpressionTempVariableRef()
+        and _isRangeLoopIteratorVariable(expression.subnode_value.getVariable())
+    )
+
+
+def _isRangeLoopValueVariable(variable, allow_copies):
+    """Decide if a variable only holds values of a "for" loop over a range.
+
+    The value of these need not become an object, unless it is used as one.
+    """
+
+    if variable.isParameterVariable() or variable.isSharedTechnically():
+        return False
+
+    if not variable.isLocalVariable() and not variable.isTempVariable():
+        return False
+
+    assign_nodes = variable.getAssignNodes()
+
+    if not assign_nodes:
+        return False
+
+    for assign_node in assign_nodes:
+        source = assign_node.subnode_source
+
+        if isRangeLoopValueSource(source):
+            continue
+
+        if (
+            allow_copies
+            and source.isExpressionVariableRefOrTempVariableRef()
+            and _isRangeLoopValueVariable(source.getVariable(), allow_copies=False)
+        ):
+            continue
+
+        return False
+
+    return _isProvenAssignedVariable(variable)
+
+
 def getPickedCType(variable, context):
     """Return type to use for specific context."""
 
@@ -201,6 +421,10 @@ def getPickedCType(variable, context):
             # everything.
 
             result = CTypeCellObject
+        elif _isRangeLoopIteratorVariable(variable):
+            result = CTypeNuitkaRangeIterator
+        elif _isRangeLoopValueVariable(variable, allow_copies=True):
+            result = CTypeNuitkaIntOrLongStruct
         else:
             shapes = variable.getTypeShapes()
 
@@ -210,7 +434,12 @@ def getPickedCType(variable, context):
                 # the future.
                 result = CTypePyObjectPtr
             else:
-                result = shapes.pop().getCType()
+                shape = shapes.pop()
+
+                if shape is tshape_float and _canUseCFloat(variable):
+                    result = CTypeCFloat
+                else:
+                    result = shape.getCType()
 
     elif context.isForDirectCall():
         if variable.isSharedTechnically():
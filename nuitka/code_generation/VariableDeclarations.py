@@ -14,6 +14,7 @@ from .c_types.CTypeCLongs import CTypeCLong, CTypeCLongDigit
 from .c_types.CTypeModuleDictVariables import CTypeModuleDictVariable
 from .c_types.CTypeNuitkaBooleans import CTypeNuitkaBoolEnum
 from .c_types.CTypeNuitkaInts import CTypeNuitkaIntOrLongStruct
+from .c_types.CTypeNuitkaRangeIterators import CTypeNuitkaRangeIterator
 from .c_types.CTypeNuitkaVoids import CTypeNuitkaVoidEnum
 from .c_types.CTypePyObjectPointers import (
     CTypeCellObject,
@@ -111,6 +112,8 @@ class VariableDeclaration(object):
             return CTypeCLongDigit
         elif c_type == "double":
             return CTypeCFloat
+        elif c_type == "nuitka_range_iter":
+            return CTypeNuitkaRangeIterator
 
         assert False, c_type
 
@@ -136,6 +139,9 @@ class VariableStorage(object):
         "variable_declarations_closure",
         "variable_declarations_locals",
         "exception_variable_name",
+        "module_value_cache_count",
+        "method_call_cache_count",
+        "attribute_cache_count",
     )
 
     def __init__(self, heap_name):
@@ -149,6 +155,10 @@ class VariableStorage(object):
 
         self.exception_variable_name = None
 
+        self.module_value_cache_count = 0
+        self.method_call_cache_count = 0
+        self.attribute_cache_count = 0
+
     @contextmanager
     def withLocalStorage(self):
         """Local storage for only just during context usage.
@@ -183,6 +193,33 @@ class VariableStorage(object):
             "static struct Nuitka_FrameObject *", "cache_%s" % frame_identifier, "NULL"
         )
 
+    def addModuleValueCacheDeclaration(self):
+        self.module_value_cache_count += 1
+
+        return self.addVariableDeclarationFunction(
+            "static struct Nuitka_ModuleValueCache",
+            "mvar_cache_%d" % self.module_value_cache_count,
+            "{NULL, 0, 0}",
+        )
+
+    def addMethodCallCacheDeclaration(self):
+        self.method_call_cache_count += 1
+
+        return self.addVariableDeclarationFunction(
+            "static struct Nuitka_MethodCallCache",
+            "mcall_cache_%d" % self.method_call_cache_count,
+            "{NULL, 0, METHOD_CALL_CACHE_EMPTY, NULL}",
+        )
+
+    def addAttributeCacheDeclaration(self):
+        self.attribute_cache_count += 1
+
+        return self.addVariableDeclarationFunction(
+            "static struct Nuitka_AttributeCache",
+            "attr_cache_%d" % self.attribute_cache_count,
+            "{NULL, 0, ATTRIBUTE_CACHE_EMPTY, NULL, -1}",
+        )
+
     def makeCStructLevelDeclarations(self):
         return [
             variable_declaration.makeCStructDeclaration()
@@ -13,6 +13,7 @@ type_indicators = {
     "struct Nuitka_CellObject *": "c",
     "nuitka_bool": "b",
     "nuitka_ilong": "L",
+    "double": "f",
 }
 
 
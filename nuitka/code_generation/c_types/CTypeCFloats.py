@@ -3,42 +3,136 @@
 
 """ CType classes for C "float" (double), (used in conjunction with PyFloatObject *)
 
+Local variables only ever holding float values use this type, so arithmetic on
+them can be done without creating float objects, which is then only done when
+the value escapes.
 """
 
 from math import copysign, isinf, isnan
 
-from .CTypeBases import CTypeBase
+from nuitka.code_generation.ErrorCodes import getReleaseCode
 
+from .CTypeBases import CTypeBase, CTypeNotReferenceCountedMixin
 
-class CTypeCFloat(CTypeBase):
+
+class CTypeCFloat(CTypeNotReferenceCountedMixin, CTypeBase):
     c_type = "double"
 
     helper_code = "CFLOAT"
 
     @classmethod
-    def emitAssignmentCodeFromConstant(
-        cls, to_name, constant, may_escape, emit, context
-    ):
-        # No context needed, pylint: disable=unused-argument
+    def getConstantValueCode(cls, constant):
         if constant == 0.0:
             if copysign(1, constant) == 1:
-                c_constant = "0.0"
+                return "0.0"
             else:
-                c_constant = "-0.0"
+                return "-0.0"
         elif isnan(constant):
             if copysign(1, constant) == 1:
-                c_constant = "NAN"
+                return "NAN"
             else:
-                c_constant = "-NAN"
+                return "-NAN"
         elif isinf(constant):
             if copysign(1, constant) == 1:
-                c_constant = "HUGE_VAL"
+                return "HUGE_VAL"
             else:
-                c_constant = "-HUGE_VAL"
+                return "-HUGE_VAL"
+        elif type(constant) is float:
+            return repr(constant)
+        else:
+            return str(constant)
+
+    @classmethod
+    def emitAssignmentCodeFromConstant(
+        cls, to_name, constant, may_escape, emit, context
+    ):
+        # No context needed, pylint: disable=unused-argument
+        emit("%s = %s;" % (to_name, cls.getConstantValueCode(constant)))
+
+    @classmethod
+    def emitVariableAssignCode(
+        cls, value_name, needs_release, tmp_name, ref_count, inplace, emit, context
+    ):
+        # Floats have no in-place operations, pylint: disable=unused-argument
+        if tmp_name.c_type == "double":
+            emit("%s = %s;" % (value_name, tmp_name))
         else:
-            c_constant = constant
+            assert tmp_name.c_type == "PyObject *", tmp_name
+
+            emit("assert(PyFloat_CheckExact(%s));" % tmp_name)
+            emit("%s = PyFloat_AS_DOUBLE(%s);" % (value_name, tmp_name))
+
+            # The caller will forget about the reference, we got it.
+            if ref_count:
+                tmp_name.getCType().getReleaseCode(
+                    value_name=tmp_name, needs_check=False, emit=emit
+                )
+
+    @classmethod
+    def emitAssignConversionCode(cls, to_name, value_name, needs_check, emit, context):
+        if value_name.c_type == cls.c_type:
+            emit("%s = %s;" % (to_name, value_name))
+        else:
+            assert value_name.c_type == "PyObject *", value_name
+
+            emit("assert(PyFloat_CheckExact(%s));" % value_name)
+            emit("%s = PyFloat_AS_DOUBLE(%s);" % (to_name, value_name))
+
+            getReleaseCode(value_name, emit, context)
 
-        emit("%s = %s;" % (to_name, c_constant))
+    @classmethod
+    def emitAssignmentCodeToNuitkaBool(
+        cls, to_name, value_name, needs_check, emit, context
+    ):
+        # Half way, virtual method: pylint: disable=unused-argument
+        emit(
+            "%s = %s ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;"
+            % (to_name, cls.getTruthCheckCode(value_name))
+        )
+
+    @classmethod
+    def getTruthCheckCode(cls, value_name):
+        return "%s != 0.0" % value_name
+
+    @classmethod
+    def emitValueAccessCode(cls, value_name, emit, context):
+        # Nothing to do for this type, pylint: disable=unused-argument
+        return value_name
+
+    @classmethod
+    def emitValueAssertionCode(cls, value_name, emit):
+        pass
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None, init_from
+
+        return "0.0"
+
+    @classmethod
+    def getInitTestConditionCode(cls, value_name, inverted):
+        # Only used for variables proven to be assigned when read.
+        return "false" if inverted else "true"
+
+    @classmethod
+    def emitReinitCode(cls, value_name, emit):
+        pass
+
+    @classmethod
+    def getDeleteObjectCode(
+        cls, to_name, value_name, needs_check, tolerant, emit, context
+    ):
+        # Variables that are deleted are not using this type.
+        assert False, value_name
+
+    @classmethod
+    def getExceptionCheckCondition(cls, value_name):
+        # Expected to not be used, pylint: disable=unused-argument
+        assert False
+
+    @classmethod
+    def hasErrorIndicator(cls):
+        return False
 
 
 #     Part of "Nuitka", an optimizing Python compiler that is compatible and
@@ -13,7 +13,9 @@ from nuitka.code_generation.templates.CodeTemplatesVariables import (
     template_del_global_known,
     template_del_global_unclear,
     template_read_mvar_unclear,
+    template_read_mvar_unclear_cached,
 )
+from nuitka.PythonVersions import python_version
 
 from .CTypeBases import CTypeBase
 
@@ -56,14 +58,25 @@ if (%(orig_name)s != %(tmp_name)s) {
     def emitValueAccessCode(cls, value_name, emit, context):
         tmp_name = context.allocateTempName("mvar_value")
 
-        emit(
-            template_read_mvar_unclear
-            % {
-                "module_identifier": context.getModuleCodeName(),
-                "tmp_name": tmp_name,
-                "var_name": context.getConstantCode(constant=value_name.code_name),
-            }
-        )
+        if 0x360 <= python_version < 0x3C0:
+            emit(
+                template_read_mvar_unclear_cached
+                % {
+                    "module_identifier": context.getModuleCodeName(),
+                    "tmp_name": tmp_name,
+                    "var_name": context.getConstantCode(constant=value_name.code_name),
+                    "cache_name": context.variable_storage.addModuleValueCacheDeclaration(),
+                }
+            )
+        else:
+            emit(
+                template_read_mvar_unclear
+                % {
+                    "module_identifier": context.getModuleCodeName(),
+                    "tmp_name": tmp_name,
+                    "var_name": context.getConstantCode(constant=value_name.code_name),
+                }
+            )
 
         return tmp_name
 
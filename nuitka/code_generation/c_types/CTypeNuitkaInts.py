@@ -24,25 +24,29 @@ class CTypeNuitkaIntOrLongStruct(CTypeBase):
     ):
         assert not inplace
 
+        # Take the reference before releasing the old value, it might be the same.
         if tmp_name.c_type == "nuitka_ilong":
+            if not ref_count:
+                cls.getTakeReferenceCode(value_name=tmp_name, emit=emit)
+
+            if needs_release is not False:
+                cls.getReleaseCode(value_name=value_name, needs_check=True, emit=emit)
+
             emit("%s = %s;" % (value_name, tmp_name))
+        elif tmp_name.c_type == "PyObject *":
+            if not ref_count:
+                emit("Py_INCREF(%s);" % tmp_name)
 
-            if ref_count:
-                emit("/* REFCOUNT ? */")
+            if needs_release is not False:
+                cls.getReleaseCode(value_name=value_name, needs_check=True, emit=emit)
 
+            emit("%s.validity = NUITKA_ILONG_OBJECT_VALID;" % value_name)
+            emit("%s.ilong_object = %s;" % (value_name, tmp_name))
         else:
-            if tmp_name.c_type == "PyObject *":
-                emit("%s.validity = NUITKA_ILONG_OBJECT_VALID;" % value_name)
-                emit("%s.ilong_object = %s;" % (value_name, tmp_name))
-
-                if ref_count:
-                    emit("/* REFCOUNT ? */")
-            else:
-                assert False, repr(tmp_name)
+            assert False, repr(tmp_name)
 
     @classmethod
     def emitVariantAssignmentCode(cls, int_name, value_name, int_value, emit, context):
-        # needs no context, pylint: disable=unused-argument
         if value_name is None:
             assert int_value is not None
             assert False  # TODO
@@ -55,9 +59,27 @@ class CTypeNuitkaIntOrLongStruct(CTypeBase):
                 emit("%s.ilong_object = %s;" % (int_name, value_name))
                 emit("%s.ilong_value = %s;" % (int_name, int_value))
 
+            context.transferCleanupTempName(value_name, int_name)
+
+    @classmethod
+    def emitAssignmentCodeToNuitkaBool(
+        cls, to_name, value_name, needs_check, emit, context
+    ):
+        # Half way, virtual method: pylint: disable=unused-argument
+
+        # The object is only ever an "int" or "long", for which truth checks
+        # cannot fail.
+        emit(
+            "%s = %s ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;"
+            % (to_name, cls.getTruthCheckCode(value_name))
+        )
+
     @classmethod
     def getTruthCheckCode(cls, value_name):
-        return "%s != 0" % value_name
+        return (
+            "((%(value_name)s.validity & NUITKA_ILONG_VALUE_VALID) == NUITKA_ILONG_VALUE_VALID ? %(value_name)s.ilong_value != 0 : CHECK_IF_TRUE(%(value_name)s.ilong_object) == 1)"
+            % {"value_name": value_name}
+        )
 
     @classmethod
     def emitValueAccessCode(cls, value_name, emit, context):
@@ -72,6 +94,8 @@ class CTypeNuitkaIntOrLongStruct(CTypeBase):
     def emitAssignConversionCode(cls, to_name, value_name, needs_check, emit, context):
         if value_name.c_type == cls.c_type:
             emit("%s = %s;" % (to_name, value_name))
+
+            context.transferCleanupTempName(value_name, to_name)
         else:
             value_name.getCType().emitAssignmentCodeToNuitkaIntOrLong(
                 to_name=to_name,
@@ -85,7 +109,7 @@ class CTypeNuitkaIntOrLongStruct(CTypeBase):
     def getInitValue(cls, init_from):
         if init_from is None:
             # TODO: In debug mode, use more crash prone maybe.
-            return "{NUITKA_ILONG_UNASSIGNED, NULL, 0}"
+            return "MAKE_ILONG_UNASSIGNED()"
         else:
             assert False, init_from
             return init_from
@@ -115,6 +139,19 @@ class CTypeNuitkaIntOrLongStruct(CTypeBase):
 
         emit("}")
 
+    @classmethod
+    def emitReinitCode(cls, value_name, emit):
+        emit("%s.validity = NUITKA_ILONG_UNASSIGNED;" % value_name)
+
+    @classmethod
+    def getTakeReferenceCode(cls, value_name, emit):
+        emit(
+            "if ((%s.validity & NUITKA_ILONG_OBJECT_VALID) == NUITKA_ILONG_OBJECT_VALID) {"
+            % value_name
+        )
+        emit("    Py_INCREF(%s.ilong_object);" % value_name)
+        emit("}")
+
     @classmethod
     def getDeleteObjectCode(
         cls, to_name, value_name, needs_check, tolerant, emit, context
@@ -0,0 +1,86 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" CType class for nuitka_range_iter, the state of a "for" loop over a range.
+
+If all values of the range fit into C "long", the loop is done in C, and
+otherwise it holds a normal iterator object. It can only be used with "next"
+of the loop, there is no object to convert it to.
+"""
+
+from .CTypeBases import CTypeBase
+
+# This is going to not use arguments very commonly. For now disable
+# the warning all around, specialize one done, pylint: disable=unused-argument
+
+
+class CTypeNuitkaRangeIterator(CTypeBase):
+    c_type = "nuitka_range_iter"
+
+    @classmethod
+    def emitValueAccessCode(cls, value_name, emit, context):
+        # Nothing to do for this type, pylint: disable=unused-argument
+        return value_name
+
+    @classmethod
+    def emitValueAssertionCode(cls, value_name, emit):
+        emit(
+            "assert(%s.iterator != NULL || %s.remaining >= 0);"
+            % (value_name, value_name)
+        )
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None
+
+        return "MAKE_RANGE_ITER_UNASSIGNED()"
+
+    @classmethod
+    def getInitTestConditionCode(cls, value_name, inverted):
+        if inverted:
+            return "(%s.iterator == NULL && %s.remaining < 0)" % (
+                value_name,
+                value_name,
+            )
+        else:
+            return "(%s.iterator != NULL || %s.remaining >= 0)" % (
+                value_name,
+                value_name,
+            )
+
+    @classmethod
+    def getReleaseCode(cls, value_name, needs_check, emit):
+        # Only present if not iterating in C.
+        emit("Py_XDECREF(%s.iterator);" % value_name)
+
+    @classmethod
+    def emitReinitCode(cls, value_name, emit):
+        emit("%s.iterator = NULL;" % value_name)
+        emit("%s.remaining = -1;" % value_name)
+
+    @classmethod
+    def getDeleteObjectCode(
+        cls, to_name, value_name, needs_check, tolerant, emit, context
+    ):
+        assert False
+
+    @classmethod
+    def emitAssignConversionCode(cls, to_name, value_name, needs_check, emit, context):
+        # Only created from range values, see "IteratorCodes".
+        assert False, value_name
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -381,6 +381,11 @@ class CTypePyObjectPtr(CPythonPyObjectPtrBase):
             emit("%s = %s.ilong_object;" % (to_name, value_name))
 
             context.transferCleanupTempName(value_name, to_name)
+        elif value_name.c_type == "double":
+            # Boxing of the C value, this is where it escapes.
+            emit("%s = MAKE_FLOAT_FROM_DOUBLE(%s);" % (to_name, value_name))
+
+            context.addCleanupTempName(to_name)
         else:
             assert False, to_name.c_type
 
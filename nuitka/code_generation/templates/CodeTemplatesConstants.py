@@ -71,7 +71,7 @@ static void _createGlobalConstants(PyThreadState *tstate) {
     Py_SysVersionInfo = Nuitka_SysGetObject("version_info");
 
     // The empty name means global.
-    loadConstantsBlob(tstate, &global_constants[0], "");
+    loadConstantsBlob(tstate, &global_constants[0], NULL, "");
 
 #if _NUITKA_EXE
     /* Set the "sys.executable" path to the original CPython executable or point to inside the
@@ -277,6 +277,11 @@ void createGlobalConstants(PyThreadState *tstate) {
 }
 """
 
+template_lazy_constant_load = """\
+if (unlikely(%(constant_code)s == NULL)) {
+    loadLazyConstant(tstate, &%(constant_code)s, mod_consts_lazy[%(lazy_index)d]);
+}"""
+
 from . import TemplateDebugWrapper  # isort:skip
 
 TemplateDebugWrapper.checkDebug(globals())
@@ -8,7 +8,20 @@
 # This uses STORE_ASYNCGEN_EXCEPTION
 
 template_frame_guard_normal_main_block = """\
-{% if frame_cache_identifier %}
+{% if frame_cache_identifier and not context_identifier %}
+{{frame_identifier}} = takeFrameFromCache(&{{frame_cache_identifier}});
+
+if ({{frame_identifier}} == NULL) {
+#if _DEBUG_REFCOUNTS
+    count_allocated_frame_cache_instances += 1;
+#endif
+    {{frame_identifier}} = {{make_frame_code}};
+#if _DEBUG_REFCOUNTS
+} else {
+    count_hit_frame_cache_instances += 1;
+#endif
+}
+{% elif frame_cache_identifier %}
 if (isFrameUnusable({{frame_cache_identifier}})) {
     Py_XDECREF({{frame_cache_identifier}});
 
@@ -84,6 +97,9 @@ popFrameStack(tstate);
 {% if frame_exit_code %}
 {{frame_exit_code}}
 {% endif %}
+{% if frame_cache_identifier and not context_identifier %}
+releaseFrameToCache(&{{frame_cache_identifier}}, {{frame_identifier}});
+{% endif %}
 
 goto {{no_exception_exit}};
 """
@@ -97,7 +113,10 @@ RESTORE_FRAME_EXCEPTION(tstate, {{frame_identifier}});
 // Put the previous frame back on top.
 popFrameStack(tstate);
 {% if frame_exit_code %}
-{{frame_exit_code}}s
+{{frame_exit_code}}
+{% endif %}
+{% if frame_cache_identifier %}
+releaseFrameToCache(&{{frame_cache_identifier}}, {{frame_identifier}});
 {% endif %}
 
 goto {{return_exit}};
@@ -133,18 +152,6 @@ RESTORE_FRAME_EXCEPTION(tstate, {{frame_identifier}});
 {{attach_locals_code}}
 {% endif %}
 
-{% if frame_cache_identifier %}
-// Release cached frame if used for exception.
-if ({{frame_identifier}} == {{frame_cache_identifier}}) {
-#if _DEBUG_REFCOUNTS
-    count_active_frame_cache_instances -= 1;
-    count_released_frame_cache_instances += 1;
-#endif
-    Py_DECREF({{frame_cache_identifier}});
-    {{frame_cache_identifier}} = NULL;
-}
-{% endif %}
-
 assertFrameObject({{frame_identifier}});
 
 // Put the previous frame back on top.
@@ -152,6 +159,9 @@ popFrameStack(tstate);
 {% if frame_exit_code %}
 {{frame_exit_code}}
 {% endif %}
+{% if frame_cache_identifier %}
+releaseFrameToCache(&{{frame_cache_identifier}}, {{frame_identifier}});
+{% endif %}
 
 // Return the error.
 goto {{parent_exception_exit}};
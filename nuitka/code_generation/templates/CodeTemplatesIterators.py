@@ -6,7 +6,7 @@
 """
 
 template_loop_break_next = """\
-if (%(to_name)s == NULL) {
+if (%(condition)s) {
     if (CHECK_AND_CLEAR_STOP_ITERATION_OCCURRED(tstate)) {
 %(break_indicator_code)s
         goto %(break_target)s;
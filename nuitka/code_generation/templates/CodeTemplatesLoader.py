@@ -66,12 +66,35 @@ static struct Nuitka_MetaPathBasedLoaderEntry meta_path_loader_entries[] = {
     {NULL, NULL, 0, 0, 0}
 };
 
+/* Hash index into the above table, to find entries by name without a
+ * scan, see "Nuitka_HashModuleName" for the hash function used.
+ */
+static int meta_path_loader_index[%(metapath_loader_index_size)d] = {
+%(metapath_loader_index)s
+};
+
+/* Indexes of extension modules in the above table, in the order a Python PGO
+ * run loaded them, to read their files ahead in the background.
+ */
+static int const extension_modules_prefetch[] = {
+%(extension_modules_prefetch)s
+    -1
+};
+
+/* Data files embedded into the binary, served from the constants blob rather
+ * than read from files, see "findEmbeddedDataFile".
+ */
+static struct Nuitka_EmbeddedDataFileEntry embedded_data_files[] = {
+%(embedded_data_files)s
+    {NULL, 0, 0}
+};
+
 static void _loadBytesCodesBlob(PyThreadState *tstate) {
     static bool init_done = false;
 
     if (init_done == false) {
         // Note needed for mere data.
-        loadConstantsBlob(tstate, (PyObject **)bytecode_data, ".bytecode");
+        loadConstantsBlob(tstate, (PyObject **)bytecode_data, NULL, ".bytecode");
 
         init_done = true;
     }
@@ -82,7 +105,10 @@ void setupMetaPathBasedLoader(PyThreadState *tstate) {
     static bool init_done = false;
     if (init_done == false) {
         _loadBytesCodesBlob(tstate);
-        registerMetaPathBasedLoader(meta_path_loader_entries, bytecode_data);
+        registerMetaPathBasedLoader(meta_path_loader_entries, meta_path_loader_index,
+                                    %(metapath_loader_index_size)d, bytecode_data);
+        registerEmbeddedDataFiles(embedded_data_files, bytecode_data);
+        prefetchExtensionModules(tstate, extension_modules_prefetch);
 
         init_done = true;
     }
@@ -51,6 +51,11 @@ static PyObject *mod_consts[%(constants_count)d];
 static Py_hash_t mod_consts_hash[%(constants_count)d];
 #endif
 
+#if %(lazy_constants_count)d > 0
+/* The blob data of module constants only unpacked when first used. */
+static unsigned char const *mod_consts_lazy[%(lazy_constants_count)d];
+#endif
+
 static PyObject *module_filename_obj = NULL;
 
 /* Indicator if this modules private constants were created yet. */
@@ -59,12 +64,13 @@ static bool constants_created = false;
 /* Function to create module private constants. */
 static void createModuleConstants(PyThreadState *tstate) {
     if (constants_created == false) {
-        loadConstantsBlob(tstate, &mod_consts[0], UN_TRANSLATE(%(module_const_blob_name)s));
+        loadConstantsBlob(tstate, &mod_consts[0], %(lazy_constants_output)s, UN_TRANSLATE(%(module_const_blob_name)s));
         constants_created = true;
 
 #ifndef __NUITKA_NO_ASSERT__
         for (int i = 0; i < %(constants_count)d; i++) {
-            mod_consts_hash[i] = DEEP_HASH(tstate, mod_consts[i]);
+            // Lazy constants are hashed when checked first after unpacking.
+            mod_consts_hash[i] = mod_consts[i] != NULL ? DEEP_HASH(tstate, mod_consts[i]) : -1;
         }
 #endif
     }
@@ -84,6 +90,13 @@ void checkModuleConstants_%(module_identifier)s(PyThreadState *tstate) {
     if (constants_created == false) return;
 
     for (int i = 0; i < %(constants_count)d; i++) {
+        // Lazy constants not yet unpacked.
+        if (mod_consts[i] == NULL) continue;
+
+        if (mod_consts_hash[i] == -1) {
+            mod_consts_hash[i] = DEEP_HASH(tstate, mod_consts[i]);
+        }
+
         assert(mod_consts_hash[i] == DEEP_HASH(tstate, mod_consts[i]));
         CHECK_OBJECT_DEEP(mod_consts[i]);
     }
@@ -325,6 +338,8 @@ PyObject *modulecode_%(module_identifier)s(PyThreadState *tstate, PyObject *modu
         NUITKA_PRINT_TRACE("%(module_identifier)s: Calling createModuleConstants().\n");
         createModuleConstants(tstate);
 
+%(module_lazy_constants_load)s
+
         createModuleCodeObjects();
 
         init_done = true;
@@ -156,6 +156,25 @@ template_read_mvar_unclear = """\
 %(tmp_name)s = LOOKUP_MODULE_VALUE(moduledict_%(module_identifier)s, %(var_name)s);
 """
 
+# Module variable read with an inline cache for the access site, Python3.6 or
+# higher, where dictionaries have version tags.
+template_read_mvar_cached = """\
+%(value_name)s = GET_MODULE_VALUE_CACHED(moduledict_%(module_identifier)s, &%(cache_name)s);
+
+if (unlikely(%(value_name)s == NULL)) {
+    %(value_name)s = GET_MODULE_VARIABLE_VALUE_CACHE_FALLBACK(tstate, moduledict_%(module_identifier)s, %(var_name)s, &%(cache_name)s);
+}
+"""
+
+# Same, but not raising, with an inline cache for the access site.
+template_read_mvar_unclear_cached = """\
+%(tmp_name)s = GET_MODULE_VALUE_CACHED(moduledict_%(module_identifier)s, &%(cache_name)s);
+
+if (unlikely(%(tmp_name)s == NULL)) {
+    %(tmp_name)s = LOOKUP_MODULE_VALUE_CACHE_FALLBACK(moduledict_%(module_identifier)s, %(var_name)s, &%(cache_name)s);
+}
+"""
+
 template_read_locals_dict_with_fallback = """\
 %(to_name)s = %(dict_get_item)s(tstate, %(locals_dict)s, %(var_name)s);
 
@@ -218,6 +237,7 @@ if (%(test_code)s) {
 %(access_code)s
 
     UPDATE_STRING_DICT0((PyDictObject *)%(dict_name)s, (Nuitka_StringObject *)%(var_name)s, value);
+%(release_code)s
 } else {
     if (DICT_REMOVE_ITEM(%(dict_name)s, %(var_name)s) == false) {
         CLEAR_ERROR_OCCURRED(tstate);
@@ -237,6 +257,7 @@ if (%(test_code)s) {
     );
 
     assert(res == 0);
+%(release_code)s
 }
 """
 
@@ -252,6 +273,7 @@ if (%(test_code)s) {
     );
 
     %(tmp_name)s = res == 0;
+%(release_code)s
 } else {
     PyObject *test_value = PyObject_GetItem(
         %(mapping_name)s,
@@ -285,6 +307,7 @@ if (%(test_code)s) {
         %(var_name)s,
         value
     );
+%(release_code)s
 } else {
     %(tmp_name)s = true;
 }
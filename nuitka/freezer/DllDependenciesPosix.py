@@ -7,17 +7,33 @@
 
 import os
 import sys
+import threading
 
+from nuitka.containers.OrderedDicts import OrderedDict
 from nuitka.containers.OrderedSets import OrderedSet
+from nuitka.Options import (
+    getJobLimit,
+    shallNotStoreDependsExeCachedResults,
+    shallNotUseDependsExeCachedResults,
+)
 from nuitka.PythonFlavors import isAnacondaPython
 from nuitka.Tracing import inclusion_logger
-from nuitka.utils.Execution import executeProcess, withEnvironmentPathAdded
+from nuitka.utils.AppDirs import getCacheDir
+from nuitka.utils.Execution import executeProcess
+from nuitka.utils.FileOperations import (
+    getFileContentByLine,
+    makePath,
+    putTextFileContents,
+    replaceFileAtomic,
+)
+from nuitka.utils.Hashing import Hash
 from nuitka.utils.SharedLibraries import getSharedLibraryRPATH
 from nuitka.utils.Utils import (
     isAlpineLinux,
     isAndroidBasedLinux,
     isPosixWindows,
 )
+from nuitka.Version import version_string
 
 from .DllDependenciesCommon import getLdLibraryPath
 
@@ -27,17 +43,11 @@ _detected_python_rpath = None
 # Cached ldd results.
 ldd_result_cache = {}
 
+# DLLs, for which the used DLLs were already added recursively.
+_ldd_recursed_dll_filenames = set()
 
-def detectBinaryPathDLLsPosix(dll_filename, package_name, original_dir):
-    # This is complex, as it also includes the caching mechanism
-    # pylint: disable=too-many-branches
-
-    if ldd_result_cache.get(dll_filename):
-        return ldd_result_cache[dll_filename]
-
-    # Ask "ldd" about the libraries being used by the created binary, these
-    # are the ones that interest us.
 
+def _getPythonRpaths():
     # This is the rpath of the Python binary, which will be effective when
     # loading the other DLLs too. This happens at least for Python installs
     # on Travis. pylint: disable=global-statement
@@ -52,35 +62,86 @@ def detectBinaryPathDLLsPosix(dll_filename, package_name, original_dir):
 
     # Single one, might be wrong for Anaconda, which uses multiple ones on at least
     # macOS.
-    python_rpaths = (_detected_python_rpath,) if _detected_python_rpath else ()
+    return (_detected_python_rpath,) if _detected_python_rpath else ()
 
-    # TODO: Actually would be better to pass it as env to the created process instead.
-    with withEnvironmentPathAdded(
-        "LD_LIBRARY_PATH",
-        *getLdLibraryPath(
-            package_name=package_name,
-            python_rpaths=python_rpaths,
-            original_dir=original_dir,
-        )
-    ):
-        # TODO: Check exit code, should never fail.
-        stdout, stderr, _exit_code = executeProcess(command=("ldd", dll_filename))
 
-    stderr = b"\n".join(
-        line
-        for line in stderr.splitlines()
-        if not line.startswith(
-            b"ldd: warning: you do not have execution permission for"
-        )
+def _getLddCacheFilename(dll_filename, ld_library_path):
+    hash_value = Hash()
+
+    # Checking the contents of large DLLs would take too long, but a changed
+    # DLL will have changed size or modification time.
+    stat_result = os.stat(dll_filename)
+
+    hash_value.updateFromValues(
+        dll_filename, repr(stat_result.st_size), repr(stat_result.st_mtime)
     )
 
-    inclusion_logger.debug("ldd output for %s is:\n%s" % (dll_filename, stdout))
+    # The search path decides which DLLs are found.
+    hash_value.updateFromValues(os.environ.get("LD_LIBRARY_PATH", ""), *ld_library_path)
 
-    if stderr:
-        inclusion_logger.debug("ldd error for %s is:\n%s" % (dll_filename, stderr))
+    # Have different values for different Python major versions.
+    hash_value.updateFromValues(sys.version, sys.executable)
+
+    # Take Nuitka version into account as well, ought to catch code changes.
+    hash_value.updateFromValues(version_string)
+
+    cache_dir = os.path.join(getCacheDir("library_dependencies"), "ldd")
+    makePath(cache_dir)
+
+    return os.path.join(cache_dir, hash_value.asHexDigest())
+
+
+def _getCachedLddResult(cache_filename):
+    # Cache files are only ever replaced as a whole, so a file that exists is
+    # complete.
+    if not os.path.exists(cache_filename):
+        return None
 
     result = OrderedSet()
 
+    for line in getFileContentByLine(cache_filename):
+        line = line.strip()
+
+        # Detect files that have become missing by ignoring the cache.
+        if not os.path.exists(line):
+            return None
+
+        result.add(line)
+
+    return result
+
+
+def _writeLddResultToCache(cache_filename, result):
+    # Other threads and processes might use the cache too, only complete files
+    # are to be seen.
+    cache_tmp_filename = "%s.%d.%d.tmp" % (
+        cache_filename,
+        os.getpid(),
+        threading.current_thread().ident,
+    )
+
+    putTextFileContents(filename=cache_tmp_filename, contents=result)
+    replaceFileAtomic(cache_tmp_filename, cache_filename)
+
+
+def _getLddEnvironment(ld_library_path):
+    # Not modifying our own environment, as this may run in threads.
+    env = dict(os.environ)
+
+    paths = [path for path in ld_library_path if path]
+
+    if paths:
+        if env.get("LD_LIBRARY_PATH"):
+            paths.insert(0, env["LD_LIBRARY_PATH"])
+
+        env["LD_LIBRARY_PATH"] = os.pathsep.join(paths)
+
+    return env
+
+
+def _parseLddOutput(stdout):
+    result = OrderedSet()
+
     for line in stdout.split(b"\n"):
         if not line:
             continue
@@ -126,8 +187,80 @@ def detectBinaryPathDLLsPosix(dll_filename, package_name, original_dir):
 
         result.add(filename)
 
+    return result
+
+
+def _getLddResult(dll_filename, package_name, original_dir):
+    """Ask "ldd" about the libraries being used by the binary.
+
+    Results are cached in memory and, unless disabled, on disk for unchanged
+    binaries. This may be called from threads.
+    """
+
+    # Binaries without dependencies have an empty result.
+    if ldd_result_cache.get(dll_filename) is not None:
+        return ldd_result_cache[dll_filename]
+
+    ld_library_path = getLdLibraryPath(
+        package_name=package_name,
+        python_rpaths=_getPythonRpaths(),
+        original_dir=original_dir,
+    )
+
+    if shallNotUseDependsExeCachedResults() and shallNotStoreDependsExeCachedResults():
+        cache_filename = None
+    else:
+        cache_filename = _getLddCacheFilename(
+            dll_filename=dll_filename, ld_library_path=ld_library_path
+        )
+
+    if cache_filename is not None and not shallNotUseDependsExeCachedResults():
+        result = _getCachedLddResult(cache_filename)
+
+        if result is not None:
+            ldd_result_cache[dll_filename] = result
+            return result
+
+    # TODO: Check exit code, should never fail.
+    stdout, stderr, _exit_code = executeProcess(
+        command=("ldd", dll_filename), env=_getLddEnvironment(ld_library_path)
+    )
+
+    stderr = b"\n".join(
+        line
+        for line in stderr.splitlines()
+        if not line.startswith(
+            b"ldd: warning: you do not have execution permission for"
+        )
+    )
+
+    inclusion_logger.debug("ldd output for %s is:\n%s" % (dll_filename, stdout))
+
+    if stderr:
+        inclusion_logger.debug("ldd error for %s is:\n%s" % (dll_filename, stderr))
+
+    result = _parseLddOutput(stdout)
+
+    if cache_filename is not None and not shallNotStoreDependsExeCachedResults():
+        _writeLddResultToCache(cache_filename=cache_filename, result=result)
+
     ldd_result_cache[dll_filename] = result
 
+    return result
+
+
+def detectBinaryPathDLLsPosix(dll_filename, package_name, original_dir):
+    result = _getLddResult(
+        dll_filename=dll_filename,
+        package_name=package_name,
+        original_dir=original_dir,
+    )
+
+    if dll_filename in _ldd_recursed_dll_filenames:
+        return result
+
+    _ldd_recursed_dll_filenames.add(dll_filename)
+
     sub_result = OrderedSet(result)
 
     for sub_dll_filename in result:
@@ -142,6 +275,80 @@ def detectBinaryPathDLLsPosix(dll_filename, package_name, original_dir):
     return sub_result
 
 
+def _prefetchLddResult(dll_filename, package_name, original_dir):
+    try:
+        _getLddResult(
+            dll_filename=dll_filename,
+            package_name=package_name,
+            original_dir=original_dir,
+        )
+    except Exception:  # Catch all the things, pylint: disable=broad-except
+        # Will be done and reported again, when the result is needed.
+        pass
+
+
+def _prefetchLddResults(dll_infos):
+    # Unlike the threaded executor in general, running "ldd" processes gains
+    # from real threads, so use them directly, where available.
+    try:
+        from concurrent.futures import (  # pylint: disable=I0021,import-error,no-name-in-module
+            ThreadPoolExecutor,
+        )
+    except ImportError:
+        # Without threads, the detection will run "ldd" as needed.
+        return
+
+    with ThreadPoolExecutor(max_workers=getJobLimit()) as worker_pool:
+        workers = [
+            worker_pool.submit(
+                _prefetchLddResult, dll_filename, package_name, original_dir
+            )
+            for dll_filename, (package_name, original_dir) in dll_infos.items()
+        ]
+
+        for worker in workers:
+            worker.result()
+
+
+def prefetchBinaryPathDLLsPosix(dll_infos):
+    """Run "ldd" for the binaries and the DLLs they use in worker threads.
+
+    The results are cached, so the later detection for each binary, done in
+    the usual order, need not wait for it.
+    """
+
+    # Package and directory giving the search path for a DLL, the first use
+    # wins, like it does with the detection.
+    top_dll_infos = OrderedDict()
+
+    for dll_filename, package_name, original_dir in dll_infos:
+        if dll_filename not in top_dll_infos:
+            top_dll_infos[dll_filename] = package_name, original_dir
+
+            # Uses plugins and module lookups, which is not for threads.
+            getLdLibraryPath(
+                package_name=package_name,
+                python_rpaths=_getPythonRpaths(),
+                original_dir=original_dir,
+            )
+
+    _prefetchLddResults(top_dll_infos)
+
+    # Since "ldd" reports the DLLs used indirectly too, one more level is all
+    # that the recursive detection will need.
+    sub_dll_infos = OrderedDict()
+
+    for dll_filename, dll_info in top_dll_infos.items():
+        for sub_dll_filename in ldd_result_cache.get(dll_filename, ()):
+            if (
+                sub_dll_filename not in ldd_result_cache
+                and sub_dll_filename not in sub_dll_infos
+            ):
+                sub_dll_infos[sub_dll_filename] = dll_info
+
+    _prefetchLddResults(sub_dll_infos)
+
+
 _linux_dll_ignore_list = [
     # Do not include kernel / glibc specific libraries. This list has been
     # assembled by looking what are the most common .so files provided by
@@ -15,6 +15,7 @@ from nuitka.containers.OrderedDicts import OrderedDict
 from nuitka.containers.OrderedSets import OrderedSet
 from nuitka.Options import (
     getOutputPath,
+    getShallEmbedDataFilePatterns,
     getShallIncludeDataDirs,
     getShallIncludeDataFiles,
     getShallIncludeExternallyDataFilePatterns,
@@ -319,6 +320,15 @@ def addIncludedDataFile(included_datafile):
 
     Plugins.onDataFileTags(included_datafile)
 
+    for embed_datafile_pattern in getShallEmbedDataFilePatterns():
+        if fnmatch.fnmatch(
+            included_datafile.dest_path, embed_datafile_pattern
+        ) or isFilenameBelowPath(
+            path=embed_datafile_pattern, filename=included_datafile.dest_path
+        ):
+            included_datafile.tags.add("embed-data")
+            included_datafile.tags.discard("copy")
+
     # TODO: Catch duplicates sooner.
     # for candidate in _included_data_files:
     #     if candidate.dest_path == included_datafile.dest_path:
@@ -340,6 +350,14 @@ def getIncludedDataFiles():
     return _included_data_files
 
 
+def getEmbeddedDataFiles():
+    return [
+        included_datafile
+        for included_datafile in _included_data_files
+        if "embed-data" in included_datafile.tags
+    ]
+
+
 def _addIncludedDataFilesFromFileOptions():
     for pattern, source_path, dest_path, arg in getShallIncludeDataFiles():
         filenames = resolveShellPatternToFilenames(pattern)
@@ -77,6 +77,9 @@ def _runOnefileScons(onefile_compression, onefile_archive):
     env_values["_NUITKA_ONEFILE_COMPRESSION_BOOL"] = "1" if onefile_compression else "0"
     env_values["_NUITKA_ONEFILE_BUILD_BOOL"] = "1" if onefile_compression else "0"
     env_values["_NUITKA_ONEFILE_ARCHIVE_BOOL"] = "1" if onefile_archive else "0"
+    env_values["_NUITKA_ONEFILE_FULL_VERIFY_BOOL"] = (
+        "1" if Options.shallOnefileCacheFullVerify() else "0"
+    )
 
     # Allow plugins to build definitions.
     env_values.update(Plugins.getBuildDefinitions())
@@ -51,7 +51,10 @@ from .DllDependenciesMacOS import (
     detectBinaryPathDLLsMacOS,
     fixupBinaryDLLPathsMacOS,
 )
-from .DllDependenciesPosix import detectBinaryPathDLLsPosix
+from .DllDependenciesPosix import (
+    detectBinaryPathDLLsPosix,
+    prefetchBinaryPathDLLsPosix,
+)
 from .DllDependenciesWin32 import detectBinaryPathDLLsWin32
 from .IncludedEntryPoints import (
     addIncludedEntryPoint,
@@ -109,6 +112,10 @@ def checkFreezingModuleSet():
         general.warning(message=message, mnemonic=mnemonic)
 
 
+def _isLddUsed():
+    return getOS() in ("Linux", "NetBSD", "FreeBSD", "OpenBSD") or isPosixWindows()
+
+
 def _detectBinaryDLLs(
     is_main_executable,
     source_dir,
@@ -124,7 +131,7 @@ def _detectBinaryDLLs(
     "otool" (macOS) the list of used DLLs is retrieved.
     """
 
-    if getOS() in ("Linux", "NetBSD", "FreeBSD", "OpenBSD") or isPosixWindows():
+    if _isLddUsed():
         return detectBinaryPathDLLsPosix(
             dll_filename=original_filename,
             package_name=package_name,
@@ -338,6 +345,23 @@ def _detectUsedDLLs(standalone_entry_point, source_dir):
 
 
 def detectUsedDLLs(standalone_entry_points, source_dir):
+    if _isLddUsed():
+        with TimerReport(
+            message="Running 'ldd' for %d DLLs took %%.2f seconds"
+            % len(standalone_entry_points),
+            decider=isShowProgress,
+        ):
+            prefetchBinaryPathDLLsPosix(
+                dll_infos=[
+                    (
+                        standalone_entry_point.source_path,
+                        standalone_entry_point.package_name,
+                        os.path.dirname(standalone_entry_point.source_path),
+                    )
+                    for standalone_entry_point in standalone_entry_points
+                ]
+            )
+
     setupProgressBar(
         stage="Detecting used DLLs",
         unit="DLL",
@@ -102,6 +102,7 @@ from nuitka.specs.BuiltinListOperationSpecs import (
     list_pop_spec,
     list_remove_spec,
     list_reverse_spec,
+    list_sort_spec,
 )
 from nuitka.specs.BuiltinParameterSpecs import extractBuiltinArgs
 from nuitka.specs.BuiltinStrOperationSpecs import (
@@ -259,6 +260,9 @@ from .ListOperationNodes import (
     ExpressionListOperationPop2,
     ExpressionListOperationRemove,
     ExpressionListOperationReverse,
+    ExpressionListOperationSort1,
+    ExpressionListOperationSort2,
+    ExpressionListOperationSort3,
 )
 from .NodeBases import SideEffectsFromChildrenMixin
 from .NodeMakingHelpers import (
@@ -8481,7 +8485,7 @@ class ExpressionAttributeLookupFixedSort(ExpressionAttributeLookupFixedBase):
     def computeExpression(self, trace_collection):
         subnode_expression = self.subnode_expression
 
-        if subnode_expression.hasShapeListExact():
+        if str is not bytes and subnode_expression.hasShapeListExact():
             result = ExpressionAttributeLookupListSort(
                 expression=subnode_expression, source_ref=self.source_ref
             )
@@ -8527,7 +8531,57 @@ class ExpressionAttributeLookupListSort(
 
         return self, None, None
 
-    # No computeExpressionCall as list operation ExpressionListOperationSort is not yet implemented
+    @staticmethod
+    def _computeExpressionCall(call_node, list_arg, trace_collection):
+        def wrapExpressionListOperationSort(key, reverse, source_ref):
+            if reverse is not None:
+                return ExpressionListOperationSort3(
+                    list_arg=list_arg, key=key, reverse=reverse, source_ref=source_ref
+                )
+            elif key is not None:
+                return ExpressionListOperationSort2(
+                    list_arg=list_arg, key=key, source_ref=source_ref
+                )
+            else:
+                return ExpressionListOperationSort1(
+                    list_arg=list_arg, source_ref=source_ref
+                )
+
+        # Anything may happen. On next pass, if replaced, we might be better
+        # but not now.
+        trace_collection.onExceptionRaiseExit(BaseException)
+
+        # Make sure we wait with knowing if the content is safe to use until its time.
+        call_node.onContentEscapes(trace_collection)
+
+        result = extractBuiltinArgs(
+            node=call_node,
+            builtin_class=wrapExpressionListOperationSort,
+            builtin_spec=list_sort_spec,
+        )
+
+        return result, "new_expression", "Call to 'sort' of list recognized."
+
+    def computeExpressionCall(self, call_node, call_args, call_kw, trace_collection):
+        return self._computeExpressionCall(
+            call_node, self.subnode_expression, trace_collection
+        )
+
+    def computeExpressionCallViaVariable(
+        self, call_node, variable_ref_node, call_args, call_kw, trace_collection
+    ):
+        list_node = makeExpressionAttributeLookup(
+            expression=variable_ref_node,
+            attribute_name="__self__",
+            # TODO: Would be nice to have the real source reference here, but it feels
+            # a bit expensive.
+            source_ref=variable_ref_node.source_ref,
+        )
+
+        return self._computeExpressionCall(call_node, list_node, trace_collection)
+
+    def mayRaiseException(self, exception_type):
+        return self.subnode_expression.mayRaiseException(exception_type)
 
 
 attribute_typed_classes.add(ExpressionAttributeLookupListSort)
@@ -404,8 +404,8 @@ class ExpressionListOperationReverse(ExpressionListOperationReverseBase):
         return self, None, None
 
 
-# TODO: The sort nodes are not yet used, because of Python2/Python3 differences
-# and keyword only arguments for generation of list.sort calls.
+# Python3 only, the Python2 "list.sort" has a "cmp" argument too and is not
+# optimized.
 
 
 class ExpressionListOperationSort1(ChildHavingListArgMixin, ExpressionBase):
@@ -441,7 +441,7 @@ class ExpressionListOperationSort1(ChildHavingListArgMixin, ExpressionBase):
 
 
 class ExpressionListOperationSort2(ChildrenHavingListArgKeyMixin, ExpressionBase):
-    """This operation represents l.sort(key)."""
+    """This operation represents l.sort(key=key)."""
 
     kind = "EXPRESSION_LIST_OPERATION_SORT2"
 
@@ -476,7 +476,7 @@ class ExpressionListOperationSort2(ChildrenHavingListArgKeyMixin, ExpressionBase
 class ExpressionListOperationSort3(
     ChildrenHavingListArgKeyOptionalReverseMixin, ExpressionBase
 ):
-    """This operation represents l.sort(key, reversed)."""
+    """This operation represents l.sort(key=key, reverse=reverse)."""
 
     kind = "EXPRESSION_LIST_OPERATION_SORT3"
 
@@ -10,6 +10,7 @@ together and cross-module optimizations are the most difficult to tackle.
 import os
 
 from nuitka import Options, Variables
+from nuitka.containers.OrderedDicts import OrderedDict
 from nuitka.containers.OrderedSets import OrderedSet
 from nuitka.importing.Importing import locateModule, makeModuleUsageAttempt
 from nuitka.importing.Recursion import decideRecursion, recurseTo
@@ -553,6 +554,13 @@ class CompiledPythonModule(
                 if old_collection is not None
                 else {}
             ),
+            # Distributions used are replaced with compile time values in the
+            # first pass, and will not be seen again.
+            distribution_names=(
+                old_collection.getUsedDistributions()
+                if old_collection is not None
+                else OrderedDict()
+            ),
         )
 
         module_body = self.subnode_body
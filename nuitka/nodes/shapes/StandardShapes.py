@@ -120,7 +120,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryAddLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryAddLShape(self)
 
             onMissingOperation("Add", self, right_shape)
 
@@ -143,7 +143,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                     return right_shape.getOperationBinaryAddLShape(self)
 
                 if right_shape_type is ShapeLoopInitialAlternative:
-                    return operation_result_unknown
+                    return right_shape.getOperationBinaryAddLShape(self)
 
                 onMissingOperation("IAdd", self, right_shape)
 
@@ -167,7 +167,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinarySubLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinarySubLShape(self)
 
             onMissingOperation("Sub", self, right_shape)
 
@@ -186,7 +186,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryMultLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryMultLShape(self)
 
             onMissingOperation("Mult", self, right_shape)
 
@@ -205,7 +205,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryFloorDivLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryFloorDivLShape(self)
 
             onMissingOperation("FloorDiv", self, right_shape)
 
@@ -224,7 +224,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryOldDivLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryOldDivLShape(self)
 
             onMissingOperation("OldDiv", self, right_shape)
 
@@ -243,7 +243,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryTrueDivLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryTrueDivLShape(self)
 
             onMissingOperation("TrueDiv", self, right_shape)
 
@@ -262,7 +262,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryModLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryModLShape(self)
 
             onMissingOperation("Mod", self, right_shape)
 
@@ -281,7 +281,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryDivmodLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryDivmodLShape(self)
 
             onMissingOperation("Divmod", self, right_shape)
 
@@ -300,7 +300,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryPowLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryPowLShape(self)
 
             onMissingOperation("Pow", self, right_shape)
 
@@ -319,7 +319,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryLShiftLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryLShiftLShape(self)
 
             onMissingOperation("LShift", self, right_shape)
 
@@ -338,7 +338,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryRShiftLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryRShiftLShape(self)
 
             onMissingOperation("RShift", self, right_shape)
 
@@ -357,7 +357,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryBitOrLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryBitOrLShape(self)
 
             onMissingOperation("BitOr", self, right_shape)
 
@@ -376,7 +376,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryBitAndLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryBitAndLShape(self)
 
             onMissingOperation("BitAnd", self, right_shape)
 
@@ -395,7 +395,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                 return right_shape.getOperationBinaryBitXorLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryBitXorLShape(self)
 
             onMissingOperation("BitXor", self, right_shape)
 
@@ -416,7 +416,7 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
                     return right_shape.getOperationBinaryBitOrLShape(self)
 
                 if right_shape_type is ShapeLoopInitialAlternative:
-                    return operation_result_unknown
+                    return right_shape.getOperationBinaryBitOrLShape(self)
 
                 onMissingOperation("IBitOr", self, right_shape)
 
@@ -437,10 +437,10 @@ class ShapeBase(getMetaClassBase("Shape", require_slots=True)):
         else:
             right_shape_type = type(right_shape)
             if right_shape_type is ShapeLoopCompleteAlternative:
-                return right_shape.getOperationBinaryBitMatMultLShape(self)
+                return right_shape.getOperationBinaryMatMultLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryMatMultLShape(self)
 
             onMissingOperation("MatMult", self, right_shape)
 
@@ -898,6 +898,96 @@ class ShapeLoopInitialAlternative(ShapeBase):
                 ControlFlowDescriptionFullEscape,
             )
 
+    def _collectInitialLShape(self, operation):
+        # Only loop carried float values are followed through operations with
+        # them on the right side, these are what can be kept as C "double"
+        # values. Others only become known once the loop is complete.
+        for type_shape in self.type_shapes:
+            if type_shape.getTypeName() != "float":
+                return operation_result_unknown
+
+        return (
+            self._collectInitialShape(operation=operation),
+            ControlFlowDescriptionFullEscape,
+        )
+
+    # Special methods to be called by other shapes encountering this type on
+    # the right side.
+    def getOperationBinaryAddLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryAddShape
+        )
+
+    def getOperationBinarySubLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinarySubShape
+        )
+
+    def getOperationBinaryMultLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryMultShape
+        )
+
+    def getOperationBinaryFloorDivLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryFloorDivShape
+        )
+
+    def getOperationBinaryOldDivLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryOldDivShape
+        )
+
+    def getOperationBinaryTrueDivLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryTrueDivShape
+        )
+
+    def getOperationBinaryModLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryModShape
+        )
+
+    def getOperationBinaryDivmodLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryDivmodShape
+        )
+
+    def getOperationBinaryPowLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryPowShape
+        )
+
+    def getOperationBinaryLShiftLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryLShiftShape
+        )
+
+    def getOperationBinaryRShiftLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryRShiftShape
+        )
+
+    def getOperationBinaryBitOrLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryBitOrShape
+        )
+
+    def getOperationBinaryBitAndLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryBitAndShape
+        )
+
+    def getOperationBinaryBitXorLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryBitXorShape
+        )
+
+    def getOperationBinaryMatMultLShape(self, left_shape):
+        return self._collectInitialLShape(
+            operation=left_shape.getOperationBinaryMatMultShape
+        )
+
     def getComparisonLtShape(self, right_shape):
         if right_shape is tshape_unknown:
             return operation_result_unknown
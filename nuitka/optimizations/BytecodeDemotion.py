@@ -7,7 +7,11 @@
 
 import marshal
 
-from nuitka.BytecodeCaching import writeImportedModulesNamesToCache
+from nuitka.BytecodeCaching import (
+    getCachedImportedModuleUsageAttempts,
+    getCachedUsedDistributions,
+    writeImportedModulesNamesToCache,
+)
 from nuitka.Bytecodes import compileSourceToBytecode
 from nuitka.freezer.ImportDetection import detectEarlyImports
 from nuitka.importing.ImportCache import (
@@ -38,9 +42,7 @@ def demoteSourceCodeToBytecode(module_name, source_code, filename):
     return marshal.dumps(bytecode)
 
 
-def demoteCompiledModuleToBytecode(module):
-    """Demote a compiled module to uncompiled (bytecode)."""
-
+def _makeUncompiledModule(module, source_code):
     full_name = module.getFullName()
     filename = module.getCompileTimeFilename()
 
@@ -50,13 +52,11 @@ def demoteCompiledModuleToBytecode(module):
             % (full_name.asString(), filename)
         )
 
-    source_code = module.getSourceCode()
-
     bytecode = demoteSourceCodeToBytecode(
         module_name=full_name, source_code=source_code, filename=filename
     )
 
-    uncompiled_module = makeUncompiledPythonModule(
+    return makeUncompiledPythonModule(
         module_name=full_name,
         reason=module.reason,
         filename=filename,
@@ -65,11 +65,9 @@ def demoteCompiledModuleToBytecode(module):
         technical=full_name in detectEarlyImports(),
     )
 
-    used_modules = module.getUsedModules()
-    uncompiled_module.setUsedModules(used_modules)
 
-    distribution_names = module.getUsedDistributions()
-    uncompiled_module.setUsedDistributions(distribution_names)
+def _replaceCompiledModule(module, uncompiled_module):
+    full_name = module.getFullName()
 
     module.finalize()
 
@@ -80,6 +78,23 @@ def demoteCompiledModuleToBytecode(module):
     if isTriggerModule(module):
         replaceTriggerModule(old=module, new=uncompiled_module)
 
+
+def demoteCompiledModuleToBytecode(module):
+    """Demote a compiled module to uncompiled (bytecode)."""
+
+    full_name = module.getFullName()
+    source_code = module.getSourceCode()
+
+    uncompiled_module = _makeUncompiledModule(module=module, source_code=source_code)
+
+    used_modules = module.getUsedModules()
+    uncompiled_module.setUsedModules(used_modules)
+
+    distribution_names = module.getUsedDistributions()
+    uncompiled_module.setUsedDistributions(distribution_names)
+
+    _replaceCompiledModule(module=module, uncompiled_module=uncompiled_module)
+
     writeImportedModulesNamesToCache(
         module_name=full_name,
         source_code=source_code,
@@ -88,6 +103,38 @@ def demoteCompiledModuleToBytecode(module):
     )
 
 
+def demoteCompiledModuleToBytecodeFromCache(module):
+    """Demote a compiled module to uncompiled (bytecode) with cached imports.
+
+    Returns the uncompiled module, or None if there is no cache entry for the
+    module, and it must be optimized to find its imports.
+    """
+
+    full_name = module.getFullName()
+    source_code = module.getSourceCode()
+
+    used_modules = getCachedImportedModuleUsageAttempts(
+        module_name=full_name,
+        source_code=source_code,
+        source_ref=module.getSourceReference(),
+    )
+
+    if used_modules is None:
+        return None
+
+    distribution_names = getCachedUsedDistributions(
+        module_name=full_name, source_code=source_code
+    )
+
+    uncompiled_module = _makeUncompiledModule(module=module, source_code=source_code)
+    uncompiled_module.setUsedModules(used_modules)
+    uncompiled_module.setUsedDistributions(distribution_names)
+
+    _replaceCompiledModule(module=module, uncompiled_module=uncompiled_module)
+
+    return uncompiled_module
+
+
 #     Part of "Nuitka", an optimizing Python compiler that is compatible and
 #     integrates with CPython, but also works on its own.
 #
@@ -25,6 +25,10 @@ from nuitka.utils.Timing import TimerReport
 
 from . import Graphs
 from .BytecodeDemotion import demoteCompiledModuleToBytecode
+from .ParallelOptimization import (
+    optimizeModulesInWorkers,
+    shallUseOptimizationWorkers,
+)
 from .Tags import TagSet
 from .TraceCollections import fetchMergeCounts, withChangeIndicationsTo
 
@@ -123,8 +127,6 @@ def optimizeCompiledPythonModule(module):
             "Memory usage changed during optimization of '%s'" % (module.getFullName())
         )
 
-    considerUsedModules(module=module, pass_count=pass_count)
-
     return touched, micro_pass
 
 
@@ -151,7 +153,7 @@ def optimizeExtensionModule(module):
     Plugins.considerImplicitImports(module=module)
 
 
-def optimizeModule(module):
+def _prepareModuleOptimization(module):
     # The tag set is global, so it can track changes without context.
     # pylint: disable=global-statement
     global tag_set
@@ -159,16 +161,31 @@ def optimizeModule(module):
 
     addExtraSysPaths(Plugins.getModuleSysPathAdditions(module.getFullName()))
 
+
+def optimizeModule(module):
+    _prepareModuleOptimization(module)
+
     if module.isPythonExtensionModule():
         optimizeExtensionModule(module)
         return False, 0
     elif module.isCompiledPythonModule():
-        return optimizeCompiledPythonModule(module)
+        result = optimizeCompiledPythonModule(module)
+
+        considerUsedModules(module=module, pass_count=pass_count)
+
+        return result
     else:
         optimizeUncompiledPythonModule(module)
         return False, 0
 
 
+def _optimizeModuleInWorker(module):
+    # Used modules are considered by the main process only.
+    _prepareModuleOptimization(module)
+
+    optimizeCompiledPythonModule(module)
+
+
 pass_count = 0
 last_total = 0
 
@@ -275,6 +292,11 @@ def makeOptimizationPass():
 
             break
 
+        if shallUseOptimizationWorkers(current_module):
+            current_module = optimizeModulesInWorkers(
+                current_module=current_module, optimize_module=_optimizeModuleInWorker
+            )
+
         if current_module.isMainModule() and not stdlib_phase_done:
             main_module = current_module
 
@@ -0,0 +1,140 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Optimization of modules in worker processes.
+
+Modules included as bytecode, e.g. the standard library in standalone mode,
+are optimized only to detect the modules they use. The result of that is
+exchanged through the bytecode cache, and none of the other facts from the
+optimization, e.g. variable traces or used functions, are needed after their
+demotion to bytecode. Therefore these can be optimized independently of each
+other in forked worker processes, where all the modules known so far, are
+available the same way as in the main process.
+
+After the workers are done, the main process demotes the modules with the
+cached information, as if it had been present at the start of compilation.
+"""
+
+from nuitka import ModuleRegistry
+from nuitka.BytecodeCaching import writeImportedModulesNamesToCache
+from nuitka.Options import (
+    getOptimizationJobLimit,
+    shallDisableBytecodeCacheUsage,
+)
+from nuitka.Tracing import optimization_logger, progress_logger
+from nuitka.utils.WorkerProcesses import (
+    distributeWorkItems,
+    isWorkerProcessSupported,
+    receiveWorkerResults,
+    startWorkerProcess,
+)
+
+from .BytecodeDemotion import demoteCompiledModuleToBytecodeFromCache
+
+
+def _isWorkerOptimizableModule(module):
+    return (
+        module.isCompiledPythonModule()
+        and module.getCompilationMode() == "bytecode"
+        and not module.isTopModule()
+    )
+
+
+def shallUseOptimizationWorkers(module):
+    return (
+        _isWorkerOptimizableModule(module)
+        and getOptimizationJobLimit() > 1
+        and isWorkerProcessSupported()
+        and not shallDisableBytecodeCacheUsage()
+    )
+
+
+def _optimizeModulesInWorker(connection, modules, optimize_module):
+    # The results are exchanged through the bytecode cache, the connection only
+    # gives back the outputs, pylint: disable=unused-argument
+
+    for module in modules:
+        optimize_module(module)
+
+        writeImportedModulesNamesToCache(
+            module_name=module.getFullName(),
+            source_code=module.getSourceCode(),
+            used_modules=module.getUsedModules(),
+            distribution_names=module.getUsedDistributions(),
+        )
+
+
+def optimizeModulesInWorkers(current_module, optimize_module):
+    """Optimize the module and the other waiting bytecode modules in workers.
+
+    Returns the module to continue with in place of the current one, which
+    normally is the demoted one, but if a worker failed, the module stays
+    compiled, and is then optimized in the main process.
+    """
+
+    modules = [current_module]
+    modules.extend(
+        module
+        for module in ModuleRegistry.getActiveModules()
+        if _isWorkerOptimizableModule(module)
+    )
+
+    # Nothing to gain for a single module.
+    if len(modules) < 2:
+        return current_module
+
+    job_count = min(getOptimizationJobLimit(), len(modules))
+
+    optimization_logger.info_if_file(
+        "Optimizing %d modules for bytecode in %d worker processes."
+        % (len(modules), job_count),
+        other_logger=progress_logger,
+    )
+
+    workers = [
+        startWorkerProcess(_optimizeModulesInWorker, job_modules, optimize_module)
+        for job_modules in distributeWorkItems(
+            items=modules,
+            job_count=job_count,
+            get_size=lambda module: len(module.getSourceCode()),
+        )
+    ]
+
+    for _result in receiveWorkerResults(workers):
+        pass
+
+    result = current_module
+
+    for module in modules:
+        uncompiled_module = demoteCompiledModuleToBytecodeFromCache(module)
+
+        if uncompiled_module is None:
+            optimization_logger.info_if_file(
+                "Worker process did not optimize '%s'." % module.getFullName(),
+                other_logger=progress_logger,
+            )
+
+            continue
+
+        ModuleRegistry.replaceTraversedModule(old=module, new=uncompiled_module)
+
+        if module is current_module:
+            result = uncompiled_module
+
+    return result
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -15,7 +15,6 @@ from contextlib import contextmanager
 
 from nuitka import Variables
 from nuitka.__past__ import iterItems  # Python3 compatibility.
-from nuitka.containers.OrderedDicts import OrderedDict
 from nuitka.containers.OrderedSets import OrderedSet
 from nuitka.ModuleRegistry import addUsedModule
 from nuitka.nodes.NodeMakingHelpers import getComputationResult
@@ -1119,7 +1118,7 @@ class TraceCollectionModule(CollectionStartPointMixin, TraceCollectionBase):
         "distribution_names",
     )
 
-    def __init__(self, module, very_trusted_module_variables):
+    def __init__(self, module, very_trusted_module_variables, distribution_names):
         assert module.isCompiledPythonModule(), module
 
         CollectionStartPointMixin.__init__(self)
@@ -1134,7 +1133,7 @@ class TraceCollectionModule(CollectionStartPointMixin, TraceCollectionBase):
         self.module_usage_attempts = OrderedSet()
 
         # Attempts to use a distribution in this module.
-        self.distribution_names = OrderedDict()
+        self.distribution_names = distribution_names
 
     def getVeryTrustedModuleVariables(self):
         return self.very_trusted_module_variables
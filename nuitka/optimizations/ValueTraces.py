@@ -22,6 +22,7 @@ from nuitka.nodes.shapes.BuiltinTypeShapes import (
     tshape_bool,
     tshape_bytes,
     tshape_dict,
+    tshape_float,
     tshape_list,
     tshape_str,
     tshape_tuple,
@@ -712,6 +713,20 @@ class ValueTraceMerge(ValueTraceMergeBase):
             if type_shape_found is None:
                 type_shape_found = type_shape
             elif type_shape is not type_shape_found:
+                # While loop analysis is not complete, keep loop carried float
+                # values together, so they can still be found to be float.
+                if (
+                    type(type_shape) is ShapeLoopInitialAlternative
+                    or type(type_shape_found) is ShapeLoopInitialAlternative
+                ):
+                    type_shapes = set()
+                    type_shape_found.emitAlternatives(type_shapes.add)
+                    type_shape.emitAlternatives(type_shapes.add)
+
+                    if type_shapes == _only_float_shape:
+                        type_shape_found = ShapeLoopInitialAlternative(type_shapes)
+                        continue
+
                 # TODO: Find the lowest common denominator.
                 return tshape_unknown
 
@@ -894,6 +909,7 @@ _only_unicode_shape = frozenset((tshape_unicode,))
 _str_plus_unicode_shape = frozenset((tshape_unicode, tshape_str))
 _only_bytes_shape = frozenset((tshape_bytes,))
 _only_bool_shape = frozenset((tshape_bool,))
+_only_float_shape = frozenset((tshape_float,))
 
 
 class ValueTraceLoopComplete(ValueTraceLoopBase):
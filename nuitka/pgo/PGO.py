@@ -17,6 +17,17 @@ _pgo_strings = None
 _module_entries = {}
 _module_exits = {}
 
+# Module names in the order they were loaded, extension modules included.
+_module_load_order = []
+
+# Observed operand type names per site, with counts.
+_type_traces = {}
+
+# Sites need to be passed this often to be considered for specialization and
+# have a type combination in this share of the passes.
+_hot_site_count = 100
+_dominant_type_share = 0.9
+
 
 def _readCString(input_file):
     return b"".join(iter(lambda: input_file.read(1), b"\0"))
@@ -30,12 +41,16 @@ def _readStringValue(input_file):
     return _pgo_strings[_readCIntValue(input_file)]
 
 
-def _readModuleIdentifierValue(input_file):
-    module_identifier = _readStringValue(input_file)
+def _readTextValue(input_file):
+    value = _readStringValue(input_file)
     if str is not bytes:
-        module_identifier = module_identifier.decode("utf8")
+        value = value.decode("utf8")
 
-    return module_identifier
+    return value
+
+
+def _readModuleIdentifierValue(input_file):
+    return _readTextValue(input_file)
 
 
 def readPGOInputFile(input_filename):
@@ -88,6 +103,19 @@ def readPGOInputFile(input_filename):
                 had_error = _readCIntValue(input_file) != 0
 
                 _module_exits[module_name] = had_error
+            elif probe_name == b"ModuleLoaded":
+                module_name = _readModuleIdentifierValue(input_file)
+                _readCIntValue(input_file)
+
+                _module_load_order.append(module_name)
+            elif probe_name == b"TypeTrace":
+                module_name = _readModuleIdentifierValue(input_file)
+                site_name = _readTextValue(input_file)
+                type_names = (_readTextValue(input_file), _readTextValue(input_file))
+                count = _readCIntValue(input_file)
+
+                site_traces = _type_traces.setdefault((module_name, site_name), {})
+                site_traces[type_names] = site_traces.get(type_names, 0) + count
             elif probe_name == b"END":
                 break
             else:
@@ -130,6 +158,54 @@ def decideInclusionFromPGO(module_name, module_kind):
         return None
 
 
+def getPGOTypeTrace(module_name, site_name):
+    """Get the dominant operand type names observed at a hot site.
+
+    Returns a tuple of type names, one per operand, with an empty string
+    for absent operands, or None if the site was not hot or had no single
+    dominant type combination, e.g. ("int", "float").
+    """
+
+    # Only if we had input of course.
+    if not _pgo_active:
+        return None
+
+    site_traces = _type_traces.get((module_name, site_name))
+    if not site_traces:
+        return None
+
+    total_count = sum(site_traces.values())
+    if total_count < _hot_site_count:
+        return None
+
+    type_names, count = max(site_traces.items(), key=lambda item: item[1])
+
+    if count < total_count * _dominant_type_share:
+        return None
+
+    return type_names
+
+
+def getPGOModuleLoadOrder(module_names):
+    """Sort module names by the order they were loaded at run time.
+
+    Modules not seen loaded at run time are not in the result, without
+    PGO input, this is empty.
+    """
+
+    # Only if we had input of course.
+    if not _pgo_active:
+        return []
+
+    module_names = set(module_names)
+
+    return [
+        module_name
+        for module_name in _module_load_order
+        if module_name in module_names
+    ]
+
+
 def decideCompilationFromPGO(module_name):
     # Only if we had input of course.
     if not _pgo_active:
@@ -400,7 +400,8 @@ def matchCall(
 
                 message = template % {
                     "arg_name": pair[0],
-                    "func_name": func_name,
+                    # Argument clinic uses the plain method name.
+                    "func_name": func_name.rsplit(".", 1)[-1],
                 }
 
                 raise TooManyArguments(TypeError(message))
@@ -478,6 +479,15 @@ def matchCall(
                         % (func_name, num_total)
                     )
                 )
+        elif kw_only_args:
+            # Only positional arguments are too many then.
+            if num_pos:
+                raise TooManyArguments(
+                    TypeError(
+                        "%s() takes no positional arguments"
+                        % func_name.rsplit(".", 1)[-1]
+                    )
+                )
         else:
             raise TooManyArguments(
                 TypeError("%s() takes no arguments (%d given)" % (func_name, num_total))
@@ -22,6 +22,7 @@ from nuitka.Serialization import (
     BuiltinSpecialValue,
     BuiltinUnionTypeValue,
     ConstantStreamReader,
+    LazyConstantValue,
 )
 from nuitka.Tracing import data_composer_logger
 from nuitka.utils.FileOperations import getFileSize, listDir, syncFileOutput
@@ -70,6 +71,9 @@ def _isAttributeName(value):
     return _match_attribute_names.match(value) or value == ".0"
 
 
+# Minimum size of ASCII str values, that the loader uses without copying.
+_blob_str_min_size = 256
+
 _last_written = None
 
 
@@ -190,6 +194,15 @@ def _writeConstantValue(output, constant_value):
         elif b"\0" in encoded:
             output.write(b"v" + _encodeVariableLength(len(encoded)))
             output.write(encoded)
+        # Large ASCII values point into the blob, also zero terminated.
+        elif (
+            str is not bytes
+            and len(encoded) >= _blob_str_min_size
+            and len(encoded) == len(constant_value)
+            and not _isAttributeName(constant_value)
+        ):
+            output.write(b"s" + _encodeVariableLength(len(encoded)))
+            output.write(encoded + b"\0")
         else:
             if str is not bytes and _isAttributeName(constant_value):
                 indicator = b"a"
@@ -279,6 +292,18 @@ def _writeConstantValue(output, constant_value):
         output.write(b"X")
         output.write(_encodeVariableLength(len(constant_value)))
         output.write(constant_value)
+    elif constant_type is LazyConstantValue:
+        # Encoded separately, so the loader can skip over it, and unpack it
+        # only when it is first used.
+        lazy_output = BytesIO()
+
+        _last_written = None
+        _writeConstantValue(lazy_output, constant_value.getValue())
+
+        constant_value = lazy_output.getvalue()
+        output.write(b"y")
+        output.write(_encodeVariableLength(len(constant_value)))
+        output.write(constant_value)
     elif constant_type is BuiltinGenericAliasValue:
         output.write(b"A")
         _last_written = None
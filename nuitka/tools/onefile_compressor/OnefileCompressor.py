@@ -9,6 +9,7 @@ import os
 import shutil
 import struct
 import sys
+import threading
 from contextlib import contextmanager
 
 from nuitka.__past__ import to_byte
@@ -25,10 +26,12 @@ from nuitka.utils.FileOperations import (
     getFileList,
     getFileSize,
     makePath,
+    replaceFileAtomic,
 )
 from nuitka.utils.Hashing import Hash, HashCRC32
 from nuitka.utils.Utils import (
     decoratorRetries,
+    getCPUCoreCount,
     isWin32OrPosixWindows,
     isWin32Windows,
 )
@@ -39,6 +42,12 @@ def getCompressorLevel(low_memory):
     return 3 if low_memory else 22
 
 
+def getCompressorThreadCount(low_memory):
+    # Highest compression levels need a lot of memory per thread, even with
+    # windows limited to file sizes, so do not use too many.
+    return 1 if low_memory else min(getCPUCoreCount(), 8)
+
+
 def getCompressorFunction(expect_compression, low_memory):
     # spell-checker: ignore zstd, closefd
 
@@ -78,6 +87,8 @@ def _attachOnefilePayloadFile(
     dist_dir,
     filename_encoding,
     file_checksums,
+    payload_checksum,
+    compression_cache_filename,
     win_path_sep,
 ):
     # Somewhat detail rich, at least unless we make more things mandatory, and
@@ -105,6 +116,9 @@ def _attachOnefilePayloadFile(
     output_file.write(filename_encoded)
     payload_item_size += len(filename_encoded)
 
+    if payload_checksum is not None:
+        payload_checksum.updateFromBytes(filename_encoded)
+
     file_flags = 0
     if not isWin32OrPosixWindows() and os.path.islink(filename_full):
         link_target = os.readlink(filename_full)
@@ -119,6 +133,9 @@ def _attachOnefilePayloadFile(
 
         output_file.write(link_target_encoded)
         payload_item_size += len(link_target_encoded)
+
+        if payload_checksum is not None:
+            payload_checksum.updateFromBytes(file_header + link_target_encoded)
     else:
         # This flag is only relevant for non-links.
         if not isWin32OrPosixWindows() and os.access(filename_full, os.X_OK):
@@ -144,10 +161,15 @@ def _attachOnefilePayloadFile(
                 # CRC32 value 0 is avoided, used as error indicator in C code.
                 file_header += struct.pack("I", hash_crc32.asDigest() or 1)
 
+                # The payload checksum covers flags, sizes, and file checksums
+                # of all files, which identifies the whole payload contents.
+                payload_checksum.updateFromBytes(file_header)
+
             if is_archive and is_compressing:
-                compression_cache_filename = _getCacheFilename(
-                    binary_filename=filename_full, low_memory=low_memory
-                )
+                if compression_cache_filename is None:
+                    compression_cache_filename = _getCacheFilename(
+                        binary_filename=filename_full, low_memory=low_memory
+                    )
 
                 if not os.path.exists(compression_cache_filename):
                     with open(compression_cache_filename, "wb") as archive_entry_file:
@@ -211,6 +233,76 @@ def _getCacheFilename(binary_filename, low_memory):
     return os.path.join(cache_dir, hash_value.asHexDigest())
 
 
+def _compressArchiveFile(filename_full, low_memory):
+    from zstandard import ZstdCompressor  # pylint: disable=I0021,import-error
+
+    compression_cache_filename = _getCacheFilename(
+        binary_filename=filename_full, low_memory=low_memory
+    )
+
+    if not os.path.exists(compression_cache_filename):
+        # Compression contexts cannot be shared between threads.
+        compressor_context = ZstdCompressor(level=getCompressorLevel(low_memory))
+
+        # Other processes might use the cache too, only complete files are
+        # to be seen.
+        compression_tmp_filename = "%s.%d.%d.tmp" % (
+            compression_cache_filename,
+            os.getpid(),
+            threading.current_thread().ident,
+        )
+
+        # Giving the size allows zstd to use a window no larger than the file,
+        # which keeps memory usage of many threads in check.
+        with open(filename_full, "rb") as input_file:
+            with open(compression_tmp_filename, "wb") as archive_entry_file:
+                with compressor_context.stream_writer(
+                    archive_entry_file,
+                    size=getFileSize(filename_full),
+                    closefd=False,
+                ) as compressed_file:
+                    shutil.copyfileobj(input_file, compressed_file)
+
+        # Other threads may have produced the same content hash meanwhile, on
+        # Windows renaming over it would fail.
+        replaceFileAtomic(compression_tmp_filename, compression_cache_filename)
+
+    return compression_cache_filename
+
+
+def _compressArchiveFiles(file_list, low_memory):
+    """Compress all files of an archive payload as separate frames in parallel.
+
+    Returns a dictionary of the files and their compression cache files, the
+    payload then only needs to copy these.
+    """
+
+    from concurrent.futures import ThreadPoolExecutor
+
+    file_list = [
+        filename_full
+        for filename_full in file_list
+        if isWin32OrPosixWindows() or not os.path.islink(filename_full)
+    ]
+
+    thread_count = getCompressorThreadCount(low_memory)
+
+    onefile_logger.info(
+        "Compressing %d onefile payload files with %d threads."
+        % (len(file_list), thread_count)
+    )
+
+    with ThreadPoolExecutor(max_workers=thread_count) as executor:
+        compression_cache_filenames = executor.map(
+            lambda filename_full: _compressArchiveFile(
+                filename_full=filename_full, low_memory=low_memory
+            ),
+            file_list,
+        )
+
+        return dict(zip(file_list, compression_cache_filenames))
+
+
 def _getInputFileList(dist_dir, start_binary):
     file_list = getFileList(dist_dir, normalize=False)
     file_list_size = len(file_list)
@@ -254,6 +346,14 @@ def attachOnefilePayload(
             start_pos = output_file.tell()
             output_file.write(b"KA" + compression_indicator)
 
+            # For cached mode, the payload checksum follows the header, it
+            # is only known at the end, and updated in place then.
+            if file_checksums:
+                payload_checksum = HashCRC32()
+                output_file.write(struct.pack("I", 0))
+            else:
+                payload_checksum = None
+
             # Move the binary to start immediately to the start position
             file_list = _getInputFileList(dist_dir=dist_dir, start_binary=start_binary)
 
@@ -288,6 +388,13 @@ def attachOnefilePayload(
 
                 is_archive = False
 
+            if is_archive and compression_indicator == b"Y":
+                compression_cache_filenames = _compressArchiveFiles(
+                    file_list=file_list, low_memory=low_memory
+                )
+            else:
+                compression_cache_filenames = {}
+
             with overall_compressor(output_file) as compressed_file:
                 for count, filename_full in enumerate(file_list, start=1):
                     payload_size += _attachOnefilePayloadFile(
@@ -302,6 +409,10 @@ def attachOnefilePayload(
                         dist_dir=dist_dir,
                         filename_encoding=filename_encoding,
                         file_checksums=file_checksums,
+                        payload_checksum=payload_checksum,
+                        compression_cache_filename=compression_cache_filenames.get(
+                            filename_full
+                        ),
                         win_path_sep=win_path_sep,
                     )
 
@@ -338,6 +449,11 @@ def attachOnefilePayload(
             # jump directly to it.
             output_file.write(struct.pack("Q", end_pos - start_pos))
 
+        if payload_checksum is not None:
+            with open(onefile_output_filename, "r+b") as output_file:
+                output_file.seek(start_pos + 3, 0)
+                output_file.write(struct.pack("I", payload_checksum.asDigest() or 1))
+
         closeProgressBar()
 
     _attachOnefilePayload()
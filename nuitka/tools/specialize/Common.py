@@ -250,7 +250,6 @@ python2_list_methods = (
     "pop",
     "remove",
     "reverse",
-    "sort",
 )
 
 python3_list_methods = (
@@ -301,9 +300,10 @@ def getMethodVariations(spec_module, shape_name, method_name, must_exist=False):
                 "list_args": spec.getStarListArgumentName(),
             }
         else:
-            required = spec.getArgumentCount() - spec.getDefaultCount()
+            arg_count = spec.getArgumentCount() + spec.getKwOnlyParameterCount()
+            required = arg_count - spec.getDefaultCount()
 
-            arg_counts = tuple(range(required, spec.getArgumentCount() + 1))
+            arg_counts = tuple(range(required, arg_count + 1))
 
             arg_names = spec.getParameterNames()
             arg_name_mapping = {}
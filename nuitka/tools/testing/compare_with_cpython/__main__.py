@@ -578,7 +578,16 @@ Taking coverage of '{filename}' using '{python}' with flags {args} ...""".format
         else:
             exe_filename += ".bin"
 
-        nuitka_cmd2 = [os.path.join(output_dir, exe_filename)]
+        if standalone_mode and not onefile_mode:
+            nuitka_cmd2 = [
+                os.path.join(
+                    output_dir,
+                    os.path.basename(filename)[:-3] + ".dist",
+                    exe_filename,
+                )
+            ]
+        else:
+            nuitka_cmd2 = [os.path.join(output_dir, exe_filename)]
 
         pdb_filename = exe_filename[:-4] + ".pdb"
 
@@ -32,6 +32,40 @@ def updateVariableUsage(provider, old_variable, new_variable):
     visitTree(provider, visitor)
 
 
+class VariableReadsCollector(VisitorNoopMixin):
+    def __init__(self):
+        self.variable_reads = {}
+
+    def _addRead(self, variable, node, variable_trace):
+        if variable not in self.variable_reads:
+            self.variable_reads[variable] = []
+
+        self.variable_reads[variable].append((node, variable_trace))
+
+    def onEnterNode(self, node):
+        if node.isExpressionVariableRefOrTempVariableRef():
+            self._addRead(node.getVariable(), node, node.getVariableTrace())
+        elif (
+            node.isExpressionBuiltinLocalsUpdated()
+            or node.isExpressionBuiltinLocalsCopy()
+            or node.isExpressionBuiltinLocalsRef()
+        ):
+            for variable, variable_trace in node.getVariableTraces() or ():
+                self._addRead(variable, node, variable_trace)
+
+
+def getVariableReads(provider):
+    """Get the reading nodes and value traces of all variables in a function.
+
+    Besides variable references, this covers the "locals()" built-in too.
+    """
+    visitor = VariableReadsCollector()
+
+    visitTree(provider, visitor)
+
+    return visitor.variable_reads
+
+
 #     Part of "Nuitka", an optimizing Python compiler that is compatible and
 #     integrates with CPython, but also works on its own.
 #
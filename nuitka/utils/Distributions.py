@@ -447,6 +447,18 @@ def getDistributionVersion(distribution):
         return distribution._version
 
 
+def getDistributionMetadataContents(distribution):
+    """Get the metadata and entry points of a distribution as one string.
+
+    This is for detecting changes of the distribution, e.g. an upgrade.
+    """
+
+    return "\n".join(
+        _getDistributionMetadataFileContents(distribution, filename) or ""
+        for filename in ("METADATA", "PKG-INFO", "entry_points.txt")
+    )
+
+
 def getDistributionLicense(distribution):
     """Get the distribution license from a distribution object."""
 
@@ -0,0 +1,169 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Forked worker processes.
+
+Node trees cannot be transferred to other processes, but forked processes have
+all of them already. The work is divided before forking, and workers send back
+results that are picklable through a connection. Their outputs, e.g. warnings
+or tracebacks, are sent back through it as well, and given out by the main
+process.
+"""
+
+import os
+import sys
+import tempfile
+
+from nuitka.containers.Namedtuples import makeNamedtupleClass
+from nuitka.PythonVersions import python_version
+
+WorkerProcess = makeNamedtupleClass("WorkerProcess", ("pid", "connection"))
+
+
+def isWorkerProcessSupported():
+    return python_version >= 0x300 and hasattr(os, "fork")
+
+
+def distributeWorkItems(items, job_count, get_size):
+    """Distribute items to jobs, giving the largest ones to the least loaded."""
+
+    job_items = [[] for _job_index in range(job_count)]
+    job_sizes = [0] * job_count
+
+    for item in sorted(items, key=get_size, reverse=True):
+        job_index = job_sizes.index(min(job_sizes))
+
+        job_items[job_index].append(item)
+        job_sizes[job_index] += get_size(item)
+
+    return job_items
+
+
+class _WorkerConnection(object):
+    """Connection of a worker process to send its results through."""
+
+    __slots__ = ("connection",)
+
+    def __init__(self, connection):
+        self.connection = connection
+
+    def send(self, result):
+        self.connection.send(("result", result))
+
+
+def _getCapturedOutput(output_file):
+    output_file.seek(0)
+
+    return output_file.read().decode("utf8", "backslashreplace")
+
+
+def startWorkerProcess(worker_function, *args):
+    """Fork a worker process, that calls the function with a connection.
+
+    The function is to send its results through the connection. Its outputs
+    are captured, and sent to the main process when it is done, so they do
+    not interfere with the ones of the main process.
+    """
+
+    import multiprocessing
+
+    reader, writer = multiprocessing.Pipe(duplex=False)
+
+    # Buffered outputs would otherwise be written by the worker too.
+    sys.stdout.flush()
+    sys.stderr.flush()
+
+    pid = os.fork()
+
+    if pid == 0:
+        reader.close()
+
+        exit_code = 1
+
+        try:
+            # The progress bar belongs to the main process.
+            from nuitka import Tracing
+
+            Tracing.progress = None
+
+            stdout_file = tempfile.TemporaryFile()
+            stderr_file = tempfile.TemporaryFile()
+
+            os.dup2(stdout_file.fileno(), 1)
+            os.dup2(stderr_file.fileno(), 2)
+
+            try:
+                worker_function(_WorkerConnection(writer), *args)
+                exit_code = 0
+            except BaseException:  # Catch all the things, pylint: disable=broad-except
+                import traceback
+
+                traceback.print_exc()
+
+            sys.stdout.flush()
+            sys.stderr.flush()
+
+            writer.send(
+                (
+                    "outputs",
+                    (_getCapturedOutput(stdout_file), _getCapturedOutput(stderr_file)),
+                )
+            )
+        finally:
+            # Never return into the main process code, and no cleanups either.
+            os._exit(exit_code)  # pylint: disable=protected-access
+
+    writer.close()
+
+    return WorkerProcess(pid=pid, connection=reader)
+
+
+def _giveWorkerOutputs(stdout_output, stderr_output):
+    if stdout_output:
+        sys.stdout.write(stdout_output)
+        sys.stdout.flush()
+
+    if stderr_output:
+        sys.stderr.write(stderr_output)
+        sys.stderr.flush()
+
+
+def receiveWorkerResults(workers):
+    """Yield the results sent by the workers until all of them exited.
+
+    The outputs of the workers are given out as they arrive.
+    """
+
+    from multiprocessing.connection import wait
+
+    workers = dict((worker.connection, worker) for worker in workers)
+
+    while workers:
+        for connection in wait(list(workers)):
+            try:
+                kind, value = connection.recv()
+            except EOFError:
+                connection.close()
+
+                os.waitpid(workers.pop(connection).pid, 0)
+            else:
+                if kind == "outputs":
+                    _giveWorkerOutputs(*value)
+                else:
+                    yield value
+
+
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -0,0 +1,355 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Tests for attribute lookups, assignments, and method calls repeated at the
+same code site.
+
+Nuitka can cache what it found for the type of the object there, these cover
+the changes that must not be missed by that.
+"""
+
+# nuitka-project: --nofollow-imports
+
+from __future__ import print_function
+
+
+def readAttribute(obj):
+    return obj.value
+
+
+def writeAttribute(obj, value):
+    obj.value = value
+
+
+def callMethod(obj):
+    return obj.method()
+
+
+def repeatRead(obj, count=3):
+    return [readAttribute(obj) for _i in range(count)]
+
+
+def repeatCall(obj, count=3):
+    return [callMethod(obj) for _i in range(count)]
+
+
+class TypeMutation(object):
+    value = "class value"
+
+    def method(self):
+        return "original method"
+
+
+def typeMutation():
+    obj = TypeMutation()
+
+    print("before:", repeatRead(obj), repeatCall(obj))
+
+    TypeMutation.value = "changed class value"
+    TypeMutation.method = lambda self: "replaced method"
+
+    print("after change:", repeatRead(obj), repeatCall(obj))
+
+    del TypeMutation.value
+
+    try:
+        readAttribute(obj)
+    except AttributeError as e:
+        print("after delete:", e)
+
+    # Adding a data descriptor to the type takes precedence over the
+    # instance dictionary.
+    obj.__dict__["value"] = "instance value"
+    print("instance value:", repeatRead(obj))
+
+    TypeMutation.value = property(lambda self: "property value")
+    print("property:", repeatRead(obj))
+
+    del TypeMutation.value
+    print("property deleted:", repeatRead(obj))
+
+
+print("Type mutation:")
+typeMutation()
+
+
+class BaseClass(object):
+    value = "base value"
+
+    def method(self):
+        return "base method"
+
+
+class DerivedClass(BaseClass):
+    pass
+
+
+def baseMutation():
+    obj = DerivedClass()
+
+    print("before:", repeatRead(obj), repeatCall(obj))
+
+    BaseClass.value = "changed base value"
+    BaseClass.method = lambda self: "changed base method"
+
+    print("base changed:", repeatRead(obj), repeatCall(obj))
+
+    DerivedClass.method = lambda self: "derived method"
+    print("derived override:", repeatCall(obj))
+
+
+print("Base class mutation:")
+baseMutation()
+
+
+class OtherClass(object):
+    value = "other value"
+
+    def method(self):
+        return "other method"
+
+
+def classAssignment():
+    obj = TypeMutation()
+    obj.value = "instance"
+
+    print("before:", repeatRead(obj), repeatCall(obj))
+
+    obj.__class__ = OtherClass
+    print("class assigned:", repeatRead(obj), repeatCall(obj))
+
+    del obj.value
+    print("instance deleted:", repeatRead(obj))
+
+
+print("Class assignment:")
+classAssignment()
+
+
+class DictClass(object):
+    def method(self):
+        return "class method"
+
+
+def dictAssignment():
+    obj = DictClass()
+    writeAttribute(obj, 1)
+    print("before:", repeatRead(obj))
+
+    obj.__dict__ = {"value": 2}
+    print("dict assigned:", repeatRead(obj))
+
+    writeAttribute(obj, 3)
+    print("write after:", repeatRead(obj), obj.__dict__)
+
+    obj.__dict__ = {"method": lambda: "instance method"}
+    print("instance method:", repeatCall(obj))
+
+    obj.__dict__ = {}
+    print("class method again:", repeatCall(obj))
+
+
+print("Dict assignment:")
+dictAssignment()
+
+
+class Shadowing(object):
+    value = "class value"
+
+    def method(self):
+        return "class method"
+
+
+def instanceShadowing():
+    obj1 = Shadowing()
+    obj2 = Shadowing()
+
+    print("before:", repeatRead(obj1), repeatCall(obj1))
+
+    obj1.value = "instance value"
+    obj1.method = lambda: "instance method"
+
+    print("shadowed:", repeatRead(obj1), repeatCall(obj1))
+    print("other instance:", repeatRead(obj2), repeatCall(obj2))
+
+    del obj1.value
+    del obj1.method
+
+    print("unshadowed:", repeatRead(obj1), repeatCall(obj1))
+
+    # Many attributes, so the instance dictionary changes its layout.
+    for i in range(50):
+        setattr(obj2, "attr%d" % i, i)
+
+    writeAttribute(obj2, "after many")
+    print("many attributes:", repeatRead(obj2))
+
+
+print("Instance shadowing:")
+instanceShadowing()
+
+
+class Slotted(object):
+    __slots__ = ("value",)
+
+    def method(self):
+        return "slotted method"
+
+
+class SlottedDerived(Slotted):
+    __slots__ = ("other",)
+
+
+def slots():
+    obj = Slotted()
+
+    try:
+        readAttribute(obj)
+    except AttributeError as e:
+        print("unassigned slot:", e)
+
+    writeAttribute(obj, "slot value")
+    print("assigned slot:", repeatRead(obj), repeatCall(obj))
+
+    del obj.value
+
+    try:
+        readAttribute(obj)
+    except AttributeError as e:
+        print("deleted slot:", e)
+
+    derived = SlottedDerived()
+    writeAttribute(derived, "derived slot value")
+    print("derived slot:", repeatRead(derived))
+
+    try:
+        obj.other = 1
+    except AttributeError as e:
+        print("no such slot:", e)
+
+
+print("Slots:")
+slots()
+
+
+class SelfDeleting(object):
+    def method(self):
+        del SelfDeleting.method
+        return "deleted itself"
+
+
+def methodDeletingItself():
+    obj = SelfDeleting()
+
+    print("first call:", callMethod(obj))
+
+    try:
+        callMethod(obj)
+    except AttributeError as e:
+        print("second call:", e)
+
+
+print("Method deleting itself:")
+methodDeletingItself()
+
+
+class CustomGetattr(object):
+    def __getattr__(self, name):
+        return "getattr " + name
+
+
+class CustomGetattribute(object):
+    value = "class value"
+
+    def __getattribute__(self, name):
+        return "getattribute " + name
+
+
+def customAttributeHandling():
+    print("getattr:", repeatRead(CustomGetattr()))
+    print("getattribute:", repeatRead(CustomGetattribute()))
+
+    obj = TypeMutation()
+    TypeMutation.value = "class value"
+    print("before:", repeatRead(obj))
+
+    TypeMutation.__getattribute__ = lambda self, name: "added getattribute"
+    print("added:", repeatRead(obj))
+
+    del TypeMutation.__getattribute__
+    print("removed:", repeatRead(obj))
+
+    TypeMutation.__setattr__ = lambda self, name, value: print("setattr", name, value)
+    writeAttribute(obj, "ignored")
+
+    del TypeMutation.__setattr__
+    writeAttribute(obj, "stored")
+    print("stored:", repeatRead(obj))
+
+
+print("Custom attribute handling:")
+customAttributeHandling()
+
+
+class DeletingKey(str):
+    # Comparing with the looked up name deletes the class attribute, while
+    # the lookup is still using it.
+    def __hash__(self):
+        return str.__hash__(self)
+
+    def __eq__(self, other):
+        if "value" in DictProbing.__dict__:
+            del DictProbing.value
+
+        return False
+
+
+class DictProbing(object):
+    def value(self):
+        return "class method deleted during lookup"
+
+
+def dictProbeMutation():
+    obj = DictProbing()
+    obj.__dict__[DeletingKey("value")] = "not found"
+
+    print("first read:", readAttribute(obj)())
+
+    try:
+        readAttribute(obj)
+    except AttributeError as e:
+        print("second read:", e)
+
+
+print("Dict probe mutation:")
+dictProbeMutation()
+
+
+def mixedTypes():
+    objects = [TypeMutation(), OtherClass(), Shadowing(), DictClass(), 1, "text"]
+    objects[3].value = "dict class value"
+
+    for obj in objects * 2:
+        try:
+            print("mixed:", type(obj).__name__, readAttribute(obj))
+        except AttributeError as e:
+            print("mixed:", type(obj).__name__, e)
+
+
+print("Mixed types:")
+mixedTypes()
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
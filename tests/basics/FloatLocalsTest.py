@@ -0,0 +1,274 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Tests for local variables that only hold floats.
+
+Nuitka can keep these as C values rather than float objects, these cover
+the values and situations where that must not be visible.
+"""
+
+# nuitka-project: --nofollow-imports
+
+from __future__ import print_function
+
+import math
+import sys
+import traceback
+
+
+def floatRepr(value):
+    # Keep the sign of zero visible, and spell special values the same.
+    return "%r (sign %r)" % (value, math.copysign(1.0, value))
+
+
+# The values are produced in loops, so they are not known at compile time,
+# but only ever floats, which lets them be kept as C values.
+
+
+def specialValues(count):
+    inf = 1e300
+    for _i in range(count):
+        inf = inf * 1e10
+
+    nan = inf - inf
+    a = inf * 0.0
+    b = -inf
+    c = nan + 1.0
+
+    print("inf:", inf, inf > 1e308, -inf < -1e308, inf == inf)
+    print("inf - inf is nan:", nan != nan, math.isnan(nan))
+    print("inf * 0 is nan:", a != a)
+    print("-inf:", b, b < 0.0, b == -inf)
+    print("nan + 1 is nan:", c != c)
+    print("nan comparisons:", c < 1.0, c > 1.0, c == c, c != c, c <= c, c >= c)
+
+
+print("Special values:")
+specialValues(2)
+
+
+def negativeZero(count):
+    zero = 1.0
+    for _i in range(count):
+        zero = zero * 0.0
+
+    neg = -zero
+    other = zero * -1.0
+    added = neg + 0.0
+    subtracted = neg - 0.0
+    multiplied = neg * 2.0
+    positive = +neg
+
+    print("zero:", floatRepr(zero))
+    print("neg:", floatRepr(neg))
+    print("other:", floatRepr(other))
+    print("neg + 0.0:", floatRepr(added))
+    print("neg - 0.0:", floatRepr(subtracted))
+    print("neg * 2.0:", floatRepr(multiplied))
+    print("+neg:", floatRepr(positive))
+    print("zero == neg:", zero == neg, zero < neg, zero <= neg)
+
+
+print("Negative zero:")
+negativeZero(2)
+
+
+def divideByZero(count):
+    x = 1.5
+    y = 1.0
+    for _i in range(count):
+        y = y * 0.0
+
+    try:
+        x = x / y
+    except ZeroDivisionError as e:
+        print("ZeroDivisionError:", e)
+
+    # Value must still be the old one.
+    print("x after failed division:", x)
+
+    try:
+        x = x % y
+    except ZeroDivisionError as e:
+        print("ZeroDivisionError:", e)
+
+    print("x after failed operations:", x)
+
+
+print("Division by zero:")
+divideByZero(1)
+
+
+def mixedInts(count):
+    x = 0.5
+    for _i in range(count):
+        x = x + 1
+        x = x * 3
+        x = 2 - x
+        x = x / 4
+
+    # Large ints are not exact as doubles, must still be correct.
+    y = 0.0
+    for _i in range(count):
+        y = y + 2**53 + 1
+
+    print("mixed:", x, y, y == 2.0**53 * count)
+
+    # Comparisons of floats with ints.
+    print("compare:", x < 1, x > -1, x == -1.0, y > 2**53)
+
+
+print("Mixed with ints:")
+mixedInts(1)
+
+
+def loopCarried(count):
+    total = 0.0
+    factor = 1.0
+
+    for i in range(count):
+        total = total + factor * i
+        factor = factor / 2.0
+
+    print("loop carried:", total, factor)
+
+    value = 1.0
+    while value < 1000.0:
+        value = value * 1.5
+
+    print("while loop:", value)
+
+    result = 0.0
+    for i in range(count):
+        if i % 2:
+            result = result - 0.25
+        else:
+            result = result + 1.0
+
+    print("loop with branches:", result)
+
+    # Leaving the loop early, with the value from inside.
+    found = 0.0
+    for i in range(count):
+        found = found + 1.5
+        if found > 4.0:
+            break
+
+    print("loop with break:", found)
+
+
+print("Loops:")
+loopCarried(10)
+
+
+def localsDict(count):
+    a = 1.0
+    for _i in range(count):
+        a = a * 1.25
+
+    b = a * 2.0
+    c = -b
+
+    d = locals()
+    print("locals:", sorted(d.items()))
+    print("types:", [type(value).__name__ for _key, value in sorted(d.items())])
+
+    # Changing the dictionary has no effect on the variables.
+    d["a"] = "changed"
+    print("after change:", a, b, c)
+
+
+print("Locals:")
+localsDict(1)
+
+
+def closures(count):
+    x = 1.0
+    for _i in range(count):
+        x = x + 0.5
+
+    y = x * 2.0
+
+    def inner():
+        return x + 1.0
+
+    x = x + 0.5
+
+    print("closure:", inner(), y)
+
+    z = 0.0
+    for _i in range(count):
+        z = z + 0.25
+
+    def lambdaUser():
+        return (lambda: z)()
+
+    print("lambda:", lambdaUser())
+
+
+print("Closures:")
+closures(1)
+
+
+def raiseInFloatCode(count):
+    x = 1.0
+    for _i in range(count):
+        x = x * 2.0
+
+    y = x * 3.0
+    z = y - 6.0
+
+    # Line numbers in tracebacks must be right.
+    return y / z
+
+
+def tracebacks():
+    try:
+        raiseInFloatCode(1)
+    except ZeroDivisionError:
+        exc_info = sys.exc_info()
+
+        for entry in traceback.extract_tb(exc_info[2]):
+            print("traceback:", entry[2], entry[3])
+
+        # Frame locals of the failed function are boxed when looked at.
+        frame = exc_info[2].tb_next.tb_frame
+        print("frame locals:", sorted(frame.f_locals.items()))
+
+
+print("Tracebacks:")
+tracebacks()
+
+
+def escaping(count):
+    x = 3.0
+    for _i in range(count):
+        x = x + 0.5
+
+    y = x + 1.0
+
+    values = [x, y]
+    result = (x, y, str(y), repr(x), int(y), hash(x) == hash(3.5))
+
+    print("escaping:", values, result)
+    print("identity check works:", type(x) is float, isinstance(y, float))
+
+    return x * y
+
+
+print("Return value:", escaping(1))
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -0,0 +1,128 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Tests for loop variables of "for" loops over "range" objects.
+
+Nuitka can keep these as C values and only create the int object when
+needed, these cover the uses where that must not be visible.
+"""
+
+# nuitka-project: --nofollow-imports
+
+from __future__ import print_function
+
+import sys
+
+
+def truthTests(n):
+    for i in range(n):
+        if i:
+            print("if i:", i)
+        else:
+            print("else:", i)
+
+        if not i:
+            print("not i:", i)
+
+        x = 1 if i else 2
+        y = "yes" if not i else "no"
+
+        print("conditional:", i, x, y, bool(i), not i)
+
+
+print("Truth tests:")
+truthTests(3)
+
+
+def truthTestsNegative(n):
+    for i in range(-n, n, 2):
+        print("negative:", i, bool(i), "true" if i else "false")
+
+
+print("Negative values:")
+truthTestsNegative(3)
+
+
+def truthTestsLarge():
+    # Values that do not fit into C long, where the fallback is used.
+    start = sys.maxsize - 2
+
+    for i in range(start, start + 4):
+        print("large:", i - start, bool(i), "true" if i else "false")
+
+
+# Python2 "range" with values beyond C long is not supported by Nuitka.
+if sys.version_info >= (3,):
+    print("Large values:")
+    truthTestsLarge()
+
+
+def escaping(n):
+    values = []
+
+    for i in range(n):
+        if i and i % 2:
+            values.append(i)
+
+    # The last value is used after the loop.
+    return i, values
+
+
+print("Escaping:", escaping(5))
+
+
+def escapingViaClosure(n):
+    for i in range(n):
+        if not i:
+            continue
+
+    def inner():
+        return i
+
+    return inner()
+
+
+print("Escaping via closure:", escapingViaClosure(4))
+
+
+def whileCondition(n):
+    result = []
+
+    for i in range(n):
+        j = i
+        while j:
+            result.append(j)
+            j = (0, 0, 1, 2)[j]
+
+    return result
+
+
+print("While condition:", whileCondition(4))
+
+
+def emptyRange():
+    i = "unchanged"
+
+    for i in range(0):
+        if i:
+            print("never")
+
+    return i
+
+
+print("Empty range:", emptyRange())
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
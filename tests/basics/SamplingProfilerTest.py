@@ -0,0 +1,111 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Test for the built-in sampling profiler of compiled programs.
+
+The program runs itself again with profiling output to a temporary file
+and checks the collapsed stacks, the outputs are then the same as without
+compilation.
+"""
+
+# nuitka-project-if: {OS} != "Windows":
+#   nuitka-project: --profile-sampling
+
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def burnInner(count):
+    result = 0.0
+
+    for i in range(count):
+        result += i * 0.5
+
+    return result
+
+
+def burnOuter():
+    total = 0.0
+
+    for _i in range(200):
+        total += burnInner(20000)
+
+    return total
+
+
+def runChild():
+    print("Child computed", burnOuter())
+
+
+def checkProfile(profile_filename):
+    with open(profile_filename) as profile_file:
+        lines = profile_file.read().splitlines()
+
+    print("Profile has samples:", bool(lines))
+
+    for line in lines:
+        stack, count = line.rsplit(" ", 1)
+        assert int(count) > 0, line
+
+        frames = stack.split(";")
+        assert frames[0].startswith("<module> ("), line
+
+        # Every frame gives name, file and a real line number.
+        for frame in frames:
+            assert frame == "[unknown]" or int(frame.rsplit(":", 1)[1][:-1]) > 0, frame
+
+    print(
+        "Profile saw burnInner below burnOuter:",
+        any("burnOuter (" in line and "burnInner (" in line for line in lines),
+    )
+
+
+def main():
+    if os.environ.get("SAMPLING_PROFILER_TEST_CHILD"):
+        runChild()
+        return
+
+    compiled = "__compiled__" in globals() and os.name != "nt"
+
+    fd, profile_filename = tempfile.mkstemp(suffix=".collapsed")
+    os.close(fd)
+
+    try:
+        env = dict(os.environ)
+        env["SAMPLING_PROFILER_TEST_CHILD"] = "1"
+        env["NUITKA_PROFILE_OUTPUT"] = profile_filename
+
+        command = [sys.argv[0]] if compiled else [sys.executable, __file__]
+
+        output = subprocess.check_output(command, env=env)
+        print(output.decode("utf8").strip())
+
+        if compiled:
+            checkProfile(profile_filename)
+        else:
+            print("Profile has samples:", True)
+            print("Profile saw burnInner below burnOuter:", True)
+    finally:
+        os.unlink(profile_filename)
+
+
+main()
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -0,0 +1,58 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+def floatLoopRightSide():
+    x = 1.0
+
+    while x < 100.0:
+        x = 2.0 * x
+
+    return type(x)
+
+
+def floatLoopMerged(cond):
+    x = 1.0
+
+    while x < 100.0:
+        if cond:
+            x = x * 2.0
+        else:
+            x = 3.0
+
+    return type(x)
+
+
+def strLoop():
+    s = ""
+
+    while len(s) < 10:
+        s = s + "a"
+
+    return type(s)
+
+
+def listLoop():
+    l = []
+
+    while len(l) < 10:
+        l = l + [1]
+
+    return type(l)
+
+
+#     Python test originally created or extracted from other peoples work. The
+#     parts from me are licensed as below. It is at least Free Software where
+#     it's copied from other people. In these cases, that will normally be
+#     indicated.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#         http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
@@ -83,6 +83,15 @@ def isConstantExpression(expression):
     )
 
 
+def isPredictedTypeExpression(expression):
+    # Type lookups replaced with the built-in type from the type shape of the
+    # value, the value reference may remain as a side effect.
+    if getKind(expression) == "SideEffects":
+        (expression,) = getRole(expression, "expression")
+
+    return getKind(expression) == "BuiltinRef"
+
+
 def checkSequence(filename, statements):
     # Complex stuff, pylint: disable=too-many-branches
 
@@ -159,6 +168,30 @@ def checkSequence(filename, statements):
         if kind in ("ReturnNone", "ReturnConstant"):
             continue
 
+        if kind == "Return":
+            (return_value,) = getRole(statement, "expression")
+
+            if not isPredictedTypeExpression(return_value):
+                search_mode.onErrorDetected(
+                    "%s: Error, return of non-constant '%s'."
+                    % (getSourceRef(filename, statement), getKind(return_value))
+                )
+
+            continue
+
+        # Local variables still alive at function end get released in the
+        # handlers, only the tried block is of interest.
+        if kind == "Try":
+            (tried,) = getRole(statement, "tried")
+            checkSequence(filename, getRole(tried, "statements"))
+
+            continue
+
+        # Loops are only used to produce values, and the types of these are
+        # then checked to be predicted after the loop.
+        if kind == "Loop":
+            continue
+
         print(toString(statement))
         search_mode.onErrorDetected(
             "Error, non-print statement of unknown kind '%s'." % kind
@@ -0,0 +1,112 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Reading data files embedded into the binary with '--embed-data-files'.
+
+The files do not exist in the distribution folder, all ways of reading them
+must give the contents, and listing directories must show them.
+"""
+
+# nuitka-project: --standalone
+# nuitka-project: --include-package=data_package
+# nuitka-project: --include-package-data=data_package
+# nuitka-project: --embed-data-files=data_package
+
+import os
+import pkgutil
+from importlib.resources import as_file, files
+
+import data_package
+
+print("pkgutil.get_data:", pkgutil.get_data("data_package", "DATA_FILE.txt"))
+print(
+    "loader get_data:", data_package.__loader__.get_data(data_package.data_file_path)
+)
+
+with open(data_package.data_file_path, "rb") as data_file:
+    print("open rb:", data_file.read())
+
+with open(data_package.data_file_path, encoding="utf8") as data_file:
+    print("open text:", data_file.readlines())
+
+with open(data_package.data_file_path, "rb") as data_file:
+    print(
+        "readable, writable, seekable:",
+        data_file.readable(),
+        data_file.writable(),
+        data_file.seekable(),
+    )
+
+    data_file.seek(9)
+    print("seek:", data_file.tell(), data_file.read(4), data_file.tell())
+
+    data_file.seek(-6, 2)
+    print("seek from end:", data_file.read())
+
+    data_file.seek(0)
+    buffer = bytearray(8)
+    print("readinto:", data_file.readinto(buffer), buffer)
+
+    data_file.seek(100)
+    print("beyond end:", data_file.read(), data_file.tell())
+
+print("closed:", data_file.closed)
+
+try:
+    data_file.read()
+except ValueError as e:
+    print("read closed:", e)
+
+package_files = files("data_package")
+
+print("read_text:", repr(package_files.joinpath("DATA_FILE.txt").read_text("utf8")))
+print("read_bytes:", (package_files / "sub" / "OTHER_FILE.txt").read_bytes())
+
+with (package_files / "DATA_FILE.txt").open("rb") as data_file:
+    print("files open rb:", data_file.read())
+
+
+def listNames(traversable):
+    # Ignore the source and bytecode of the package, not there when compiled.
+    return sorted(
+        child.name
+        for child in traversable.iterdir()
+        if not child.name.endswith(".py") and child.name != "__pycache__"
+    )
+
+
+print("iterdir:", listNames(package_files))
+print("iterdir sub:", listNames(package_files / "sub"))
+print(
+    "is_dir:",
+    (package_files / "sub").is_dir(),
+    (package_files / "DATA_FILE.txt").is_dir(),
+)
+print(
+    "is_file:",
+    (package_files / "sub").is_file(),
+    (package_files / "DATA_FILE.txt").is_file(),
+)
+
+with as_file(package_files / "DATA_FILE.txt") as data_path:
+    with open(data_path, "rb") as data_file:
+        print("as_file:", data_file.read())
+
+    print("as_file is file:", os.path.isfile(data_path))
+
+print("OK.")
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
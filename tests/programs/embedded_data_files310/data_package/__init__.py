@@ -0,0 +1,29 @@
+#     Copyright 2024, Kay Hayen, mailto:kay.hayen@gmail.com find license text at end of file
+
+
+""" Package with data files, read from inside of it. """
+
+import os
+
+data_file_path = os.path.join(os.path.dirname(__file__), "DATA_FILE.txt")
+
+# Reading with the path of the file, from compiled code.
+with open(data_file_path, "rb") as data_file:
+    print("open rb in package:", data_file.read())
+
+print("exists in package:", os.path.exists(data_file_path))
+
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.